@@ -9,6 +9,10 @@
  * Modify __MAIN__ on L12 to determine which main method is executed.
  * __MAIN__ = 0 - Initialization and software sampling of a default ADC and pin.
  *          = 1 - Initialization software sampling of multiple pins on a single ADC.
+ *          = 2 - Interrupt driven sampling of multiple pins on a single ADC.
+ *          = 3 - Timer triggered sampling of multiple pins on a single ADC.
+ *          = 4 - Continuous 500 kHz streaming of a pin into two buffers with the uDMA.
+ *          = 5 - Synchronized sampling of a voltage and current pair on both ADCs.
  */
 #define __MAIN__ 0
 
@@ -95,4 +99,228 @@ int main(void) {
             adcOutputSeq0[i] = 0;
     };
 }
+#elif __MAIN__ == 2
+int main(void) {
+    /**
+     * This program demonstrates initializing the pin PE3 and PE2 as an ADC and
+     * reading from it without busy waiting on the conversion.
+     */
+    PLLInit(BUS_80_MHZ);
+    DisableInterrupts();
+
+    /* Initialize SysTick for delay calls.*/
+    DelayInit();
+
+    /* Initialize an interrupt driven ADC sampling on PE3, PE2. */
+    ADCConfig_t adcPE3Config = {
+        .pin=AIN0,
+        .position=ADC_SEQPOS_0,
+        .isNotEndSample=true,
+        .priority=1
+    };
+    ADCConfig_t adcPE2Config = {
+        .pin=AIN1,
+        .position=ADC_SEQPOS_1,
+        .priority=1
+    };
+    ADCInit(adcPE3Config);
+    ADCInit(adcPE2Config);
+
+    uint16_t adcOutputSeq0[8] = {0};
+    volatile uint8_t numSamples = 0;
+
+    EnableInterrupts();
+    while (1) {
+        /* Every 100ms, kick off a conversion. The sequencer handler queues
+           the result, and it is collected on a later pass of the loop. */
+        ADCStartSequencer(adcPE3Config.module, adcPE3Config.sequencer);
+        DelayMillisec(100);
+        numSamples = ADCTryRead(
+            adcPE3Config.module,
+            adcPE3Config.sequencer,
+            adcOutputSeq0
+        );
+    };
+}
+#elif __MAIN__ == 3
+int main(void) {
+    /**
+     * This program demonstrates sampling the pins PE3 and PE2 at an exact 1
+     * kHz rate. A hardware timer starts each conversion, and the CPU sleeps
+     * until a result is ready.
+     */
+    PLLInit(BUS_80_MHZ);
+    DisableInterrupts();
+
+    /* Initialize a timer that triggers the ADC every 1ms. It has no task, so
+       its own interrupt is never armed. */
+    TimerConfig_t timerConfig = {
+        .timerID=TIMER_0A,
+        .period=freqToPeriod(1000, MAX_FREQ),
+        .isPeriodic=true,
+        .isADCTrigger=true
+    };
+    TimerInit(timerConfig);
+
+    /* Initialize a timer triggered ADC sampling on PE3, PE2. */
+    ADCConfig_t adcPE3Config = {
+        .pin=AIN0,
+        .position=ADC_SEQPOS_0,
+        .isNotEndSample=true,
+        .priority=1,
+        .trigger=ADC_TRIGGER_TIMER
+    };
+    ADCConfig_t adcPE2Config = {
+        .pin=AIN1,
+        .position=ADC_SEQPOS_1,
+        .priority=1,
+        .trigger=ADC_TRIGGER_TIMER
+    };
+    ADCInit(adcPE3Config);
+    ADCInit(adcPE2Config);
+
+    uint16_t adcOutputSeq0[8] = {0};
+    volatile uint8_t numSamples = 0;
+
+    /* Arm the sequencer interrupt once. The timer starts every sequence. */
+    ADCStartSequencer(adcPE3Config.module, adcPE3Config.sequencer);
+
+    EnableInterrupts();
+    while (1) {
+        /* Sleep until the sequencer handler queues a result. */
+        WaitForInterrupt();
+        numSamples = ADCTryRead(
+            adcPE3Config.module,
+            adcPE3Config.sequencer,
+            adcOutputSeq0
+        );
+    };
+}
+#elif __MAIN__ == 4
+#define STREAM_SIZE 512
+
+static uint16_t streamBufferA[STREAM_SIZE];
+static uint16_t streamBufferB[STREAM_SIZE];
+volatile uint32_t streamMean = 0;
+
+/**
+ * @brief Called from the ADC handler each time a buffer of samples is full.
+ *        Must return before the other buffer fills, in about 1ms.
+ */
+void StreamTask(uint16_t * buffer, uint16_t numSamples) {
+    uint32_t sum = 0;
+    uint16_t i;
+    for (i = 0; i < numSamples; ++i) {
+        sum += buffer[i];
+    }
+    streamMean = sum / numSamples;
+}
+
+int main(void) {
+    /**
+     * This program demonstrates sampling the pin PE3 at 500 kHz. The uDMA moves
+     * every sample into two alternating buffers, and the CPU only runs once
+     * per buffer of 512 samples.
+     */
+    PLLInit(BUS_80_MHZ);
+    DisableInterrupts();
+
+    /* Initialize a timer that triggers the ADC every 2us. */
+    TimerConfig_t timerConfig = {
+        .timerID=TIMER_0A,
+        .period=freqToPeriod(500000, MAX_FREQ),
+        .isPeriodic=true,
+        .isADCTrigger=true
+    };
+    TimerInit(timerConfig);
+
+    /* Initialize a timer triggered ADC on PE3, using the single position
+       sequencer SS3. The module must convert faster than the trigger rate. */
+    ADCConfig_t adcConfig = {
+        .pin=AIN0,
+        .sequencer=ADC_SS_3,
+        .sampleRate=ADC_RATE_1M,
+        .trigger=ADC_TRIGGER_TIMER
+    };
+    ADCInit(adcConfig);
+
+    ADCStreamConfig_t streamConfig = {
+        .module=ADC_MODULE_0,
+        .sequencer=ADC_SS_3,
+        .bufferA=streamBufferA,
+        .bufferB=streamBufferB,
+        .bufferSize=STREAM_SIZE,
+        .streamTask=StreamTask
+    };
+    ADCStreamStart(streamConfig);
+
+    EnableInterrupts();
+    while (1) {
+        WaitForInterrupt();
+    };
+}
+#elif __MAIN__ == 5
+#define POWER_PAIRS 100
+
+static uint16_t powerBufferA[2 * POWER_PAIRS];
+static uint16_t powerBufferB[2 * POWER_PAIRS];
+volatile uint32_t meanPower = 0;
+
+/**
+ * @brief Called from the ADC handler each time a buffer of voltage and
+ *        current pairs is full. Must return before the other buffer fills, in
+ *        about 10ms.
+ */
+void PowerTask(uint16_t * buffer, uint16_t numPairs) {
+    uint32_t sum = 0;
+    uint16_t i;
+    for (i = 0; i < numPairs; ++i) {
+        sum += (uint32_t)buffer[2 * i] * buffer[2 * i + 1];
+    }
+    meanPower = sum / numPairs;
+}
+
+int main(void) {
+    /**
+     * This program demonstrates sampling a voltage on PE3 and a current on PE2
+     * at the same instant, 10 kHz, for instantaneous power. ADC 0 samples the
+     * voltage and ADC 1 the current, both started by the same timer.
+     */
+    PLLInit(BUS_80_MHZ);
+    DisableInterrupts();
+
+    /* Initialize a timer that triggers both ADCs every 100us. */
+    TimerConfig_t timerConfig = {
+        .timerID=TIMER_0A,
+        .period=freqToPeriod(10000, MAX_FREQ),
+        .isPeriodic=true,
+        .isADCTrigger=true
+    };
+    TimerInit(timerConfig);
+
+    /* Pair PE3 on ADC 0 with PE2 on ADC 1, using the single position
+       sequencer SS3 of both. */
+    ADCSyncConfig_t syncConfig = {
+        .pins={{AIN0}, {AIN1}},
+        .numPairs=1,
+        .sequencer=ADC_SS_3,
+        .trigger=ADC_TRIGGER_TIMER,
+        .priority=1
+    };
+    ADCSync_t sync = ADCSyncInit(syncConfig);
+
+    ADCSyncStreamConfig_t streamConfig = {
+        .sync=sync,
+        .bufferA=powerBufferA,
+        .bufferB=powerBufferB,
+        .bufferSize=2 * POWER_PAIRS,
+        .streamTask=PowerTask
+    };
+    ADCSyncStreamStart(streamConfig);
+
+    EnableInterrupts();
+    while (1) {
+        WaitForInterrupt();
+    };
+}
 #endif
@@ -17,7 +17,7 @@
 #include <lib/GPIO/GPIO.h>
 
 
-GPIOPin_t pins[2] = { PIN_B0, PIN_COUNT };
+GPIOPin_t pins[2] = { PIN_B0, PIN_B5 };
 DACConfig_t config = {
     .pins=pins,
     .numPins=1
@@ -34,7 +34,6 @@ int main(void) {
     DACOut(dac, 1); // GPIO_PORTB_DATA_R should be 0x01.
     DACOut(dac, 2); // GPIO_PORTB_DATA_R should be 0x00.
 
-    config.pins[1] = PIN_B5; 
     config.numPins = 2;
     dac = DACInit(config);
 
@@ -6,10 +6,9 @@
  * @date 2021-10-28
  * @copyright Copyright (c) 2021
  * @note
- * __FAST__. If you check the target options, in the C/C++ Misc Options, `-D__FAST__` is defined.
- * __FAST__ is present in GPIO.c; it selects between two definitions of GPIOSetBit and GPIOGetBit.
- * __FAST__ trades speed for space complexity. It's very useful for when you
- * want to do GPIO bit handling or very fast consecutive GPIO bit handling!
+ * GPIOSetBit and GPIOGetBit are inline. With a constant pin, each call is a
+ * single store or load, which is very useful for when you want to do GPIO bit
+ * handling or very fast consecutive GPIO bit handling!
  * 
  * Modify __MAIN__ on L18 to determine which main method is executed.
  * __MAIN__ = 0 - Initialization and management of a timer acting as a PWM for low freq.
@@ -67,10 +67,10 @@ int main(void) {
 
     TimerConfig_t timerConfigs[4] = {
         /* The first timer has keyed arguments notated to show you what each positional argument means. */
-        {.timerID=TIMER_0A, .period=freqToPeriod(1600, MAX_FREQ), .isIndividual=true,  .prescale=15, .timerTask=dummyTask1, .isPeriodic=true, .priority=5, .timerArgs=NULL},
-        {         TIMER_0B,         freqToPeriod(1600, MAX_FREQ),               true,             7,            dummyTask2,             true,           5,            NULL},
-        {         TIMER_1A,         freqToPeriod(400, MAX_FREQ),                false,            0,            dummyTask3,             true,           5,            NULL},
-        {         WTIMER_0A,        freqToPeriod(800, MAX_FREQ),                false,            0,            dummyTask4,             true,           5,            NULL},
+        {.timerID=TIMER_0A, .period=freqToPeriod(1600, MAX_FREQ), .isIndividual=true,  .prescale=15, .timerTask=dummyTask1, .isPeriodic=true, .priority=5, .timerArgs=NULL, .isADCTrigger=false},
+        {         TIMER_0B,         freqToPeriod(1600, MAX_FREQ),               true,             7,            dummyTask2,             true,           5,            NULL,     false},
+        {         TIMER_1A,         freqToPeriod(400, MAX_FREQ),                false,            0,            dummyTask3,             true,           5,            NULL,     false},
+        {         WTIMER_0A,        freqToPeriod(800, MAX_FREQ),                false,            0,            dummyTask4,             true,           5,            NULL,     false},
     };
 
     /* Initialize four timers based on the timer configuration array above. */
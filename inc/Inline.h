@@ -0,0 +1,20 @@
+/**
+ * @file Inline.h
+ * @author agent (agent@local)
+ * @brief Portable inline function declarations.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+/**
+ * STATIC_INLINE declares an inline function local to a translation unit.
+ * armcc and the TI compiler only accept the inline keyword in C99 mode, so
+ * they take __inline, which they accept in C90 mode as well.
+ */
+#if defined(__ARMCC_VERSION) || defined(__TI_COMPILER_VERSION__)
+#define STATIC_INLINE static __inline
+#else
+#define STATIC_INLINE static inline
+#endif
@@ -78,6 +78,7 @@
 #define SYSCTL_RCC2_OFFSET          0x070
 #define SYSCTL_RCGCTIMER_OFFSET     0x604
 #define SYSCTL_RCGCGPIO_OFFSET      0x608
+#define SYSCTL_RCGCDMA_OFFSET       0x60C
 #define SYSCTL_RCGCUART_OFFSET      0x618
 #define SYSCTL_RCGCSSI_OFFSET       0x61C
 #define SYSCTL_RCGCI2C_OFFSET       0x620
@@ -88,6 +89,7 @@
 
 #define SYSCTL_PRTIMER_OFFSET       0xA04
 #define SYSCTL_PRGPIO_OFFSET        0xA08
+#define SYSCTL_PRDMA_OFFSET         0xA0C
 #define SYSCTL_PRUART_OFFSET        0xA18
 #define SYSCTL_PRSSI_OFFSET         0xA1C
 #define SYSCTL_PRI2C_OFFSET         0xA20
@@ -96,6 +98,32 @@
 #define SYSCTL_PRPWM_OFFSET         0xA40
 #define SYSCTL_PRWTIMER_OFFSET      0xA5C
 
+/**
+ * See the uDMA Register Map in chapter 9 of the TM4C Datasheet for more
+ * details. The channel control table is described by Table 9-3 and Table 9-4.
+ */
+#define UDMA_BASE               0x400FF000
+#define UDMA_STAT_OFFSET        0x000
+#define UDMA_CFG_OFFSET         0x004
+#define UDMA_CTLBASE_OFFSET     0x008
+#define UDMA_ALTBASE_OFFSET     0x00C
+#define UDMA_WAITSTAT_OFFSET    0x010
+#define UDMA_SWREQ_OFFSET       0x014
+#define UDMA_USEBURSTSET_OFFSET 0x018
+#define UDMA_USEBURSTCLR_OFFSET 0x01C
+#define UDMA_REQMASKSET_OFFSET  0x020
+#define UDMA_REQMASKCLR_OFFSET  0x024
+#define UDMA_ENASET_OFFSET      0x028
+#define UDMA_ENACLR_OFFSET      0x02C
+#define UDMA_ALTSET_OFFSET      0x030
+#define UDMA_ALTCLR_OFFSET      0x034
+#define UDMA_PRIOSET_OFFSET     0x038
+#define UDMA_PRIOCLR_OFFSET     0x03C
+#define UDMA_ERRCLR_OFFSET      0x04C
+#define UDMA_CHASGN_OFFSET      0x500
+#define UDMA_CHIS_OFFSET        0x504
+#define UDMA_CHMAP0_OFFSET      0x510
+
 /** 
  * See Table 10-6. GPIO Register Map on p. 660 of the TM4C Datasheet for more
  * details. 
@@ -285,6 +313,7 @@
 #define PWM_OFFSET          0x040
 #define PWM_ENABLE_OFFSET   0x008
 #define PWM_CTL_OFFSET      0x040
+#define PWM_INTEN_OFFSET    0x044
 #define PWM_LOAD_OFFSET     0x050
 #define PWM_CMPA_OFFSET     0x058
 #define PWM_CMPB_OFFSET     0x05C
@@ -6,13 +6,14 @@
  * @date 2021-09-22
  * @copyright Copyright (c) 2021
  * @note
- * Unsupported Features. This driver does not support DMA control. This driver
- * does not support different trigger sources or interrupts. The driver does not
- * support configurable sample sequencer priorities.
+ * Unsupported Features. This driver does not support the analog comparator
+ * trigger sources. The driver does not support configurable sample sequencer
+ * priorities.
  */
 
 /** General Imports. */
 #include <stdbool.h>
+#include <stdlib.h>
 #include <assert.h>
 
 /** Device specific imports. */
@@ -35,6 +36,173 @@ static GPIOPin_t ADCPinMapping[12] = {
     PIN_B5
 };
 
+/** @brief ADCFrame_t is the content of a sequencer FIFO after one sequence. */
+typedef struct ADCFrame {
+    uint64_t timestamp;
+    uint16_t values[8];
+    uint8_t count;
+} ADCFrame_t;
+
+/**
+ * @brief ADCRing is a single producer, single consumer ring of frames for a
+ *        sequencer. The sequencer handler is the only writer of head and
+ *        ADCTryRead is the only writer of tail. Both are free running and
+ *        masked on access.
+ */
+static struct ADCRing {
+    volatile ADCFrame_t frames[ADC_RING_DEPTH];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile uint32_t dropped;
+} ADCRings[2][4];
+
+/**
+ * @brief ADCSnapshot is the latest sequence converted by a sequencer, shared
+ *        by every ADC_t on it. generation counts the sequences published, so
+ *        0 means no snapshot has been taken yet.
+ */
+static struct ADCSnapshot {
+    volatile uint16_t values[8];
+    volatile uint8_t count;
+    volatile uint32_t generation;
+} ADCSnapshots[2][4];
+
+/** @brief ADCTimestampTimer is the wide timer stamping frames, if
+ *         ADCIsTimestamped. */
+static Timer_t ADCTimestampTimer;
+static bool ADCIsTimestamped = false;
+
+/** @brief ADCIsSnapshotOnly marks the sequencers whose handler skips the
+ *         frame ring. */
+static bool ADCIsSnapshotOnly[2][4];
+
+/**
+ * @brief ADCOversample is the state of an oversampling sequencer. The
+ *        handler sums numPerOutput sequences, then publishes the sums plus
+ *        offset, shifted right by shift. A numPerOutput of 0 marks a
+ *        sequencer that is not oversampling.
+ */
+static struct ADCOversample {
+    uint32_t sums[8];
+    uint32_t offset;
+    uint16_t numSequences;
+    uint16_t numPerOutput;
+    uint8_t shift;
+    bool isProcessorTriggered;
+} ADCOversamples[2][4];
+
+/**
+ * @brief ADCStream is the state of a sequencer streaming with the uDMA.
+ *        isAlternate selects the descriptor, and buffer, that completes next.
+ */
+static struct ADCStream {
+    DMAChannel_t channel;
+    uint16_t * buffers[2];
+    uint16_t bufferSize;
+    bool isAlternate;
+    void (*streamTask)(uint16_t * buffer, uint16_t numSamples);
+} ADCStreams[2][4];
+
+/**
+ * @brief ADCSyncStream is the state of a synchronized stream on a sequencer
+ *        of both modules. numValues counts the values already in the buffer
+ *        being filled.
+ */
+static struct ADCSyncStream {
+    uint16_t * buffers[2];
+    uint16_t bufferSize;
+    uint16_t numValues;
+    uint8_t numPairs;
+    bool isAlternate;
+    void (*streamTask)(uint16_t * buffer, uint16_t numPairs);
+} ADCSyncStreams[4];
+
+/** @brief ADCComparatorSettings is the state of each digital comparator. */
+static struct ADCComparatorSettings {
+    /** @brief User function called on a crossing. */
+    void (*comparatorTask)(bool isHigh, uint32_t * args);
+
+    /** @brief User args associated with the function. */
+    uint32_t * comparatorArgs;
+
+    enum ADCComparatorEvent event;
+
+    /** @brief State after the last crossing. */
+    volatile bool isHigh;
+
+    /** @brief Whether the comparator has been assigned. */
+    bool isUsed;
+} ADCComparators[2][ADC_NUM_COMPARATORS];
+
+/**
+ * @brief ADCDMAChannels is the uDMA channel of each sequencer, all with
+ *        encoding 0.
+ */
+static const uint8_t ADCDMAChannels[2][4] = {
+    {14, 15, 16, 17}, /* ADC 0. */
+    {24, 25, 26, 27}  /* ADC 1. */
+};
+
+/** @brief ADCSequencerDepths is the FIFO depth, and maximum sequence length,
+ *         of each sequencer. */
+static const uint8_t ADCSequencerDepths[4] = {8, 4, 4, 1};
+
+/**
+ * @brief ADCInterruptSettings is the NVIC IRQ number of each sequencer
+ *        interrupt.
+ */
+static const uint8_t ADCInterruptSettings[2][4] = {
+    {14, 15, 16, 17}, /* ADC 0. */
+    {48, 49, 50, 51}  /* ADC 1. */
+};
+
+/**
+ * @brief ADCInitGPIOTrigger makes the rising edge of a pin an ADC trigger. The
+ *        pin's GPIO interrupt is not armed.
+ *
+ * @param pin The trigger pin. Its port must already be initialized.
+ */
+static void ADCInitGPIOTrigger(GPIOPin_t pin) {
+    /* 1. Generate the port offset and pin address. See GPIOIntInit. */
+    uint32_t portOffset =
+        (((pin - ((pin >= PIN_E0) << 5)) >> 3) << 12) +
+        ((pin >= PIN_E0) << 17);
+    uint8_t pinAddress = 1 << pin % 8;
+
+    /* 2. Set pin as sensitive to a single, rising edge. */
+    GET_REG(GPIO_PORT_BASE + portOffset + GPIO_IS_OFFSET) &= ~pinAddress;
+    GET_REG(GPIO_PORT_BASE + portOffset + GPIO_IBE_OFFSET) &= ~pinAddress;
+    GET_REG(GPIO_PORT_BASE + portOffset + GPIO_IEV_OFFSET) |= pinAddress;
+
+    /* 3. Clear flag for the pin. */
+    GET_REG(GPIO_PORT_BASE + portOffset + GPIO_ICR_OFFSET) = pinAddress;
+
+    /* 4. Route the pin's edge events to the ADC. */
+    GET_REG(GPIO_PORT_BASE + portOffset + GPIO_ADCCTL_OFFSET) |= pinAddress;
+}
+
+/**
+ * @brief ADCInitPWMTrigger makes a PWM generator emit an ADC trigger each
+ *        time its counter reaches zero.
+ *
+ * @param moduleBase Base address of the triggered ADC module.
+ * @param pwmModule The PWM module, 0 or 1. Must already be initialized.
+ * @param generator The PWM generator, 0 - 3.
+ */
+static void ADCInitPWMTrigger(uint32_t moduleBase, uint8_t pwmModule, uint8_t generator) {
+    /* The PWM registers fault if the module clock is not running. */
+    assert(GET_REG(SYSCTL_BASE + SYSCTL_PRPWM_OFFSET) & (1 << pwmModule));
+
+    uint32_t PWMBase = !pwmModule * PWM0_BASE + pwmModule * PWM1_BASE;
+
+    /* 1. Select which PWM module drives the generator trigger. */
+    GET_REG(moduleBase + ADC_TSSEL) &= ~(0x3 << (4 + 8 * generator));
+    GET_REG(moduleBase + ADC_TSSEL) |= pwmModule << (4 + 8 * generator);
+
+    /* 2. Emit a trigger when the counter reaches zero (TrCntZero). */
+    GET_REG(PWMBase + PWM_INTEN_OFFSET + PWM_OFFSET * generator) |= 0x100;
+}
+
 ADC_t ADCInit(ADCConfig_t config) {
     /* Initialization asserts. */
     assert(config.pin <= AIN11);
@@ -43,6 +211,15 @@ ADC_t ADCInit(ADCConfig_t config) {
     assert(config.position <= ADC_SEQPOS_7);
     assert(config.oversampling <= ADC_AVG_64);
     assert(config.phase <= ADC_PHASE_337_5);
+    assert(config.sampleRate <= ADC_RATE_1M);
+    assert(config.priority <= 7);
+    assert(
+        config.trigger == ADC_TRIGGER_PROCESSOR ||
+        (ADC_TRIGGER_GPIO <= config.trigger && config.trigger <= ADC_TRIGGER_PWM_GEN_3) ||
+        config.trigger == ADC_TRIGGER_ALWAYS
+    );
+    assert(config.triggerPin < PIN_COUNT);
+    assert(config.triggerPWMModule <= 1);
 
     /* 1. Enable the relevant pin GPIO. */
     GPIOConfig_t pin = {
@@ -69,16 +246,13 @@ ADC_t ADCInit(ADCConfig_t config) {
 
     /**
      * Note: things not touched for now:
-     * - ADC_IM (interrupts)
-     * - ADC_TSSEL (PWM trigger only)
      * - ADC_SPC (Sample phase control)
      * - ADC_PSSI (Sample sequence initiate - startSample func?)
-     * - ADC_DCISC (Digital comparator interrupt status and clear. Not used.)
      */
 
-    /* 4. Set sample rate to 125ksps. */
+    /* 4. Set the sample rate. The rates are encoded as 0x1, 0x3, 0x5, 0x7. */
     GET_REG(moduleBase + ADC_PC) &= ~0xF;
-    GET_REG(moduleBase + ADC_PC) |= 0x1;
+    GET_REG(moduleBase + ADC_PC) |= (config.sampleRate << 1) | 0x1;
 
     /* 5. Set sequencer priority to ss3=0 ... ss0=3. */
     GET_REG(moduleBase + ADC_SSPRI) = 0x0123;
@@ -88,7 +262,12 @@ ADC_t ADCInit(ADCConfig_t config) {
 
     /* 7. Configure conversion trigger option. */
     GET_REG(moduleBase + ADC_EMUX) &= ~(0xF << (4 * config.sequencer));
-    GET_REG(moduleBase + ADC_EMUX) |= (/* TODO: config.trigger*/ 0 << (4 * config.sequencer));
+    GET_REG(moduleBase + ADC_EMUX) |= (config.trigger << (4 * config.sequencer));
+    if (config.trigger == ADC_TRIGGER_GPIO) {
+        ADCInitGPIOTrigger(config.triggerPin);
+    } else if (ADC_TRIGGER_PWM_GEN_0 <= config.trigger && config.trigger <= ADC_TRIGGER_PWM_GEN_3) {
+        ADCInitPWMTrigger(moduleBase, config.triggerPWMModule, config.trigger - ADC_TRIGGER_PWM_GEN_0);
+    }
 
     /* 8. Configure sample averaging control. */
     GET_REG(moduleBase + ADC_SAC) = config.oversampling;
@@ -99,7 +278,15 @@ ADC_t ADCInit(ADCConfig_t config) {
     /* 10. Phase control. */
     GET_REG(moduleBase + ADC_SPC) = config.phase;
 
-    /* . TODO: Interrupt control. */
+    /* 11. Set the sequencer interrupt priority. The interrupt itself is
+           only armed by ADCStartSequencer. */
+    uint8_t IRQ = ADCInterruptSettings[config.module][config.sequencer];
+    uint32_t priorityAddr = PERIPHERALS_BASE + NVIC_PRI0_OFFSET + 4 * (IRQ >> 2);
+    GET_REG(priorityAddr) &= ~(0xFF << ((IRQ & 3) * 8));
+    GET_REG(priorityAddr) |= (config.priority << 5) << ((IRQ & 3) * 8);
+
+    /* 12. Record whether the handler publishes frames to the ring. */
+    ADCIsSnapshotOnly[config.module][config.sequencer] = config.isSnapshotOnly;
 
     uint32_t sequencerOffset = ADC_SS0 + 0x020 * config.sequencer;
 
@@ -115,9 +302,8 @@ ADC_t ADCInit(ADCConfig_t config) {
         ((0b0110 * !config.isNotEndSample) << (config.position << 2));
 
     /**
-     * Note: these registers are not currently touched for now:
-     * - ADC_SSOP sample sequence operation
-     * - ADC_SSDC sample sequence digital comparator select
+     * Note: ADC_SSOP and ADC_SSDC, which route samples to the digital
+     * comparators, are set by ADCComparatorInit.
      */
 
     /* 8. Reenable ADCACTSS. */
@@ -145,9 +331,52 @@ bool ADCIsFull(enum ADCModule module, enum ADCSequencer sequencer) {
     return GET_REG(moduleBase + sequencerOffset + ADC_SSFSTAT) & 0x1000;
 }
 
-uint16_t ADCSampleSingle(ADC_t adc) {
-    uint32_t moduleBase = !adc.module * ADC0_BASE + adc.module * ADC1_BASE;
-    uint32_t sequencerOffset = ADC_SS0 + 0x020 * adc.sequencer;
+/**
+ * @brief ADCSequenceRead drains one sequence from a sequencer FIFO into the
+ *        values of its positions. Positions routed to a digital comparator
+ *        (ADC_SSOP) have no FIFO entry, so they are skipped and read as 0.
+ *
+ * @param moduleBase The base address of the ADC module.
+ * @param sequencer The ADCSequencer to drain.
+ * @param values The value of each position.
+ * @return The number of positions up to the last one read from the FIFO.
+ */
+static uint8_t ADCSequenceRead(
+    uint32_t moduleBase,
+    enum ADCSequencer sequencer,
+    volatile uint16_t values[8]
+) {
+    uint32_t sequencerOffset = ADC_SS0 + 0x020 * sequencer;
+    uint32_t comparatorPositions = GET_REG(moduleBase + sequencerOffset + ADC_SSOP);
+    uint8_t count = 0;
+    uint8_t position;
+    for (position = 0; position < 8; ++position) {
+        if (comparatorPositions & (1 << (4 * position))) {
+            values[position] = 0;
+            continue;
+        }
+        if (GET_REG(moduleBase + sequencerOffset + ADC_SSFSTAT) & 0x100) break;
+        values[position] = GET_REG(moduleBase + sequencerOffset + ADC_SSFIFO) & 0xFFF;
+        count = position + 1;
+    }
+    return count;
+}
+
+/**
+ * @brief ADCSnapshotTake triggers a sequencer once, busy waits for it to
+ *        complete and publishes the sequence as the sequencer's snapshot.
+ *
+ * @param module The ADCModule to execute.
+ * @param sequencer The ADCSequencer to execute.
+ * @return The updated snapshot.
+ */
+static struct ADCSnapshot * ADCSnapshotTake(enum ADCModule module, enum ADCSequencer sequencer) {
+    uint32_t moduleBase = !module * ADC0_BASE + module * ADC1_BASE;
+    uint32_t sequencerOffset = ADC_SS0 + 0x020 * sequencer;
+    struct ADCSnapshot * snapshot = &ADCSnapshots[module][sequencer];
+
+    /* The sequencer must not be interrupt driven. */
+    assert((GET_REG(moduleBase + ADC_IM) & (1 << sequencer)) == 0);
 
     /* 0. Clear internal FIFO beforehand. */
     while (!(GET_REG(moduleBase + sequencerOffset + ADC_SSFSTAT) & 0x100)) {
@@ -155,25 +384,25 @@ uint16_t ADCSampleSingle(ADC_t adc) {
     }
 
     /* 1. Initiate sampling in the sample sequencers. */
-    GET_REG(moduleBase + ADC_PSSI) =  1 << adc.sequencer;
+    GET_REG(moduleBase + ADC_PSSI) =  1 << sequencer;
 
     /* 2. Wait for flag that conversion is done. */
-    while ((GET_REG(moduleBase + ADC_RIS) & (1 << adc.sequencer)) == 0) {}
+    while ((GET_REG(moduleBase + ADC_RIS) & (1 << sequencer)) == 0) {}
 
     /* 3. Read result from the FIFO. */
-    uint16_t result = 0;
-    uint8_t i = 0;
-    for (; !(GET_REG(moduleBase + sequencerOffset + ADC_SSFSTAT) & 0x100) && i < 8; ++i) {
-        if (i == adc.position)
-            result = GET_REG(moduleBase + sequencerOffset +  ADC_SSFIFO) & 0xFFF;
-        else
-            GET_REG(moduleBase + sequencerOffset +  ADC_SSFIFO);
-    }
+    snapshot->count = ADCSequenceRead(moduleBase, sequencer, snapshot->values);
+    snapshot->generation++;
 
     /* 4. Clear flag. ADC_ISC clear interrupt */
-    GET_REG(moduleBase + ADC_ISC) |= 1 << adc.sequencer;
+    GET_REG(moduleBase + ADC_ISC) = 1 << sequencer;
 
-    return result;
+    return snapshot;
+}
+
+uint16_t ADCSampleSingle(ADC_t adc) {
+    struct ADCSnapshot * snapshot = ADCSnapshotTake(adc.module, adc.sequencer);
+    if (adc.position >= snapshot->count) return 0;
+    return snapshot->values[adc.position];
 }
 
 void ADCSampleSequencer(
@@ -181,32 +410,749 @@ void ADCSampleSequencer(
     enum ADCSequencer sequencer,
     uint16_t arr[8]
 ) {
+    struct ADCSnapshot * snapshot = ADCSnapshotTake(module, sequencer);
+    uint8_t i;
+    for (i = 0; i < snapshot->count; ++i) {
+        arr[i] = snapshot->values[i];
+    }
+}
+
+uint16_t ADCSampleSnapshot(ADC_t adc, bool isFresh) {
+    uint32_t moduleBase = !adc.module * ADC0_BASE + adc.module * ADC1_BASE;
+    struct ADCSnapshot * snapshot = &ADCSnapshots[adc.module][adc.sequencer];
+
+    /* 1. Convert a new sequence if asked to, or if there is none yet. */
+    if (isFresh || snapshot->generation == 0) {
+        if (GET_REG(moduleBase + ADC_IM) & (1 << adc.sequencer)) {
+            /* The sequencer is started, so its handler publishes the next
+               sequence. A streaming sequencer never publishes one. */
+            assert(ADCStreams[adc.module][adc.sequencer].streamTask == NULL);
+            uint32_t generation = snapshot->generation;
+            if ((GET_REG(moduleBase + ADC_EMUX) & (0xF << (4 * adc.sequencer))) == 0) {
+                GET_REG(moduleBase + ADC_PSSI) = 1 << adc.sequencer;
+            }
+            while (snapshot->generation == generation) {}
+        } else {
+            ADCSnapshotTake(adc.module, adc.sequencer);
+        }
+    }
+
+    /* 2. Serve the pin's step from the snapshot. */
+    if (adc.position >= snapshot->count) return 0;
+    return snapshot->values[adc.position];
+}
+
+uint32_t ADCGetSnapshotGeneration(enum ADCModule module, enum ADCSequencer sequencer) {
+    return ADCSnapshots[module][sequencer].generation;
+}
+
+void ADCStartSequencer(enum ADCModule module, enum ADCSequencer sequencer) {
+    uint32_t moduleBase = !module * ADC0_BASE + module * ADC1_BASE;
+
+    /* 1. Arm the sequencer interrupt and enable its IRQ in the NVIC. */
+    GET_REG(moduleBase + ADC_IM) |= 1 << sequencer;
+    uint8_t IRQ = ADCInterruptSettings[module][sequencer];
+    GET_REG(PERIPHERALS_BASE + NVIC_EN0_OFFSET + 4 * (IRQ >> 5)) = 1 << (IRQ & 31);
+
+    /* 2. Initiate sampling in the sample sequencer, unless the hardware
+          triggers it. */
+    if ((GET_REG(moduleBase + ADC_EMUX) & (0xF << (4 * sequencer))) == 0) {
+        GET_REG(moduleBase + ADC_PSSI) = 1 << sequencer;
+    }
+}
+
+uint8_t ADCTryRead(enum ADCModule module, enum ADCSequencer sequencer, uint16_t arr[8]) {
+    uint64_t timestamp;
+    return ADCTryReadTimestamped(module, sequencer, arr, &timestamp);
+}
+
+uint8_t ADCTryReadTimestamped(
+    enum ADCModule module,
+    enum ADCSequencer sequencer,
+    uint16_t arr[8],
+    uint64_t * timestamp
+) {
+    struct ADCRing * ring = &ADCRings[module][sequencer];
+    uint8_t tail = ring->tail;
+    if (tail == ring->head) return 0;
+
+    volatile ADCFrame_t * frame = &ring->frames[tail & (ADC_RING_DEPTH - 1)];
+    uint8_t count = frame->count;
+    uint8_t i;
+    for (i = 0; i < count; ++i) {
+        arr[i] = frame->values[i];
+    }
+    *timestamp = frame->timestamp;
+
+    /* Release the frame back to the handler only after it is copied. */
+    ring->tail = tail + 1;
+    return count;
+}
+
+uint32_t ADCGetDroppedCount(enum ADCModule module, enum ADCSequencer sequencer) {
+    return ADCRings[module][sequencer].dropped;
+}
+
+void ADCTimestampInit(TimerID_t timer) {
+    /* Initialization asserts. */
+    assert(WTIMER_0A <= timer && timer <= WTIMER_5A);
+    assert((timer % 2) == 0);
+
+    /* 1. Count down from the largest 64 bit period. At MAX_FREQ, it does not
+          time out for thousands of years. */
+    TimerConfig_t timerConfig = {
+        .timerID=timer,
+        .period=0xFFFFFFFFFFFFFFFF,
+        .isPeriodic=true
+    };
+    ADCTimestampTimer = TimerInit(timerConfig);
+
+    /* 2. Stamp frames from now on. */
+    ADCIsTimestamped = true;
+}
+
+uint64_t ADCGetTimestamp(void) {
+    /* Initialization asserts. */
+    assert(ADCIsTimestamped);
+
+    /* The timer counts down from 2^64 - 2, so its complement counts up from
+       1. */
+    return ~TimerGetValue(ADCTimestampTimer);
+}
+
+void ADCStreamStart(ADCStreamConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.module <= ADC_MODULE_1);
+    assert(config.sequencer <= ADC_SS_3);
+    assert(config.bufferA != NULL);
+    assert(config.bufferB != NULL);
+    assert(0 < config.bufferSize && config.bufferSize <= DMA_MAX_TRANSFER_SIZE);
+    assert(config.streamTask != NULL);
+
+    uint32_t moduleBase = !config.module * ADC0_BASE + config.module * ADC1_BASE;
+    uint32_t sequencerOffset = ADC_SS0 + 0x020 * config.sequencer;
+
+    /* The FIFO is streamed as is, so no position may go to a comparator. */
+    assert(GET_REG(moduleBase + sequencerOffset + ADC_SSOP) == 0);
+    volatile void * fifo = (volatile void *)(moduleBase + sequencerOffset + ADC_SSFIFO);
+
+    /* The sequencer must be hardware triggered and not interrupt driven. */
+    assert(GET_REG(moduleBase + ADC_EMUX) & (0xF << (4 * config.sequencer)));
+    assert((GET_REG(moduleBase + ADC_IM) & (1 << config.sequencer)) == 0);
+
+    /* 1. Set up the sequencer's uDMA channel to move 16 bit samples from the
+          FIFO into the buffers, rearbitrating after every sample. */
+    DMAInit();
+    DMAConfig_t dmaConfig = {
+        .channel=ADCDMAChannels[config.module][config.sequencer],
+        .itemSize=DMA_SIZE_16,
+        .isSourceFixed=true
+    };
+    DMAChannel_t channel = DMAChannelInit(dmaConfig);
+
+    /* 2. Save the stream before any buffer can complete. */
+    struct ADCStream * stream = &ADCStreams[config.module][config.sequencer];
+    stream->channel = channel;
+    stream->buffers[0] = config.bufferA;
+    stream->buffers[1] = config.bufferB;
+    stream->bufferSize = config.bufferSize;
+    stream->isAlternate = false;
+    stream->streamTask = config.streamTask;
+
+    /* 3. Point the primary descriptor at bufferA and the alternate at
+          bufferB, then enable the channel. */
+    DMATransferSet(channel, false, DMA_MODE_PINGPONG, fifo, config.bufferA, config.bufferSize);
+    DMATransferSet(channel, true, DMA_MODE_PINGPONG, fifo, config.bufferB, config.bufferSize);
+    DMAChannelEnable(channel);
+
+    /* 4. Have the sequencer request the uDMA (ADEN). */
+    GET_REG(moduleBase + ADC_ACTSS) |= 0x100 << config.sequencer;
+
+    /* 5. Arm the sequencer interrupt and enable its IRQ in the NVIC. The
+          uDMA signals buffer completion on this interrupt. */
+    GET_REG(moduleBase + ADC_IM) |= 1 << config.sequencer;
+    uint8_t IRQ = ADCInterruptSettings[config.module][config.sequencer];
+    GET_REG(PERIPHERALS_BASE + NVIC_EN0_OFFSET + 4 * (IRQ >> 5)) = 1 << (IRQ & 31);
+}
+
+void ADCStreamStop(enum ADCModule module, enum ADCSequencer sequencer) {
     uint32_t moduleBase = !module * ADC0_BASE + module * ADC1_BASE;
-    uint32_t sequencerOffset = ADC_SS0 + 0x020 * sequencer;
+    struct ADCStream * stream = &ADCStreams[module][sequencer];
 
-    /* 0. Clear internal FIFO beforehand. */
+    /* 1. Disarm the sequencer interrupt and its uDMA requests. */
+    GET_REG(moduleBase + ADC_IM) &= ~(1 << sequencer);
+    GET_REG(moduleBase + ADC_ACTSS) &= ~(0x100 << sequencer);
+
+    /* 2. Disable the channel. */
+    DMAChannelDisable(stream->channel);
+    stream->streamTask = NULL;
+}
+
+void ADCOversampleStart(ADCOversampleConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.module <= ADC_MODULE_1);
+    assert(config.sequencer <= ADC_SS_3);
+    assert(1 <= config.extraBits && config.extraBits <= 4);
+
+    uint32_t moduleBase = !config.module * ADC0_BASE + config.module * ADC1_BASE;
+    struct ADCOversample * oversample = &ADCOversamples[config.module][config.sequencer];
+
+    /* The sequencer must not be streaming. */
+    assert(ADCStreams[config.module][config.sequencer].streamTask == NULL);
+
+    /* The hardware averager truncates each of its averages to 12 bits, so it
+       may cover at most 2^extraBits of the 4^extraBits conversions. */
+    uint8_t hardwareShift = GET_REG(moduleBase + ADC_SAC) & 0x7;
+    assert(hardwareShift <= config.extraBits);
+
+    /* 1. Dither, so the quantization error varies between conversions. */
+    if (!config.isNotDithered) {
+        GET_REG(moduleBase + ADC_CTL) |= 0x40;
+    }
+
+    /* 2. Sum 4^n / 2^k sequences of hardware averages per output, and keep
+          n bits of their sum beyond the 12 bit average. */
+    uint8_t i;
+    for (i = 0; i < 8; ++i) {
+        oversample->sums[i] = 0;
+    }
+    oversample->numSequences = 0;
+    oversample->shift = config.extraBits - hardwareShift;
+
+    /* 3. Round to nearest. Each hardware average is also truncated by
+          (2^k - 1) / 2^(k + 1) on average, which is added back. Both are
+          summed in units of 1 / 2^(k + 1), then rounded. */
+    uint32_t numPerOutput = 1 << (2 * config.extraBits - hardwareShift);
+    uint32_t hardwareCount = 1 << hardwareShift;
+    oversample->offset = (
+        (hardwareCount << oversample->shift) +
+        numPerOutput * (hardwareCount - 1) +
+        hardwareCount
+    ) >> (hardwareShift + 1);
+    oversample->isProcessorTriggered =
+        (GET_REG(moduleBase + ADC_EMUX) & (0xF << (4 * config.sequencer))) == 0;
+    oversample->numPerOutput = numPerOutput;
+
+    /* 4. Start the sequencer. */
+    ADCStartSequencer(config.module, config.sequencer);
+}
+
+void ADCOversampleStop(enum ADCModule module, enum ADCSequencer sequencer) {
+    uint32_t moduleBase = !module * ADC0_BASE + module * ADC1_BASE;
+
+    /* 1. Disarm the sequencer interrupt. */
+    GET_REG(moduleBase + ADC_IM) &= ~(1 << sequencer);
+    ADCOversamples[module][sequencer].numPerOutput = 0;
+}
+
+/**
+ * @brief ADCOversampleAccumulate drains a sequence of an oversampling
+ *        sequencer into its sums. Once the batch is complete, decimates the
+ *        sums into the snapshot. Otherwise, restarts a
+ *        processor triggered sequencer.
+ *
+ * @param module The ADCModule that interrupted.
+ * @param sequencer The ADCSequencer that interrupted.
+ * @param snapshot The snapshot of the sequencer.
+ * @return The number of values decimated into the snapshot. 0 while the
+ *         batch is incomplete.
+ */
+static uint8_t ADCOversampleAccumulate(
+    enum ADCModule module,
+    enum ADCSequencer sequencer,
+    struct ADCSnapshot * snapshot
+) {
+    uint32_t moduleBase = !module * ADC0_BASE + module * ADC1_BASE;
+    struct ADCOversample * oversample = &ADCOversamples[module][sequencer];
+
+    uint16_t values[8];
+    uint8_t count = ADCSequenceRead(moduleBase, sequencer, values);
+    uint8_t i;
+    for (i = 0; i < count; ++i) {
+        oversample->sums[i] += values[i];
+    }
+
+    if (++oversample->numSequences < oversample->numPerOutput) {
+        if (oversample->isProcessorTriggered) {
+            GET_REG(moduleBase + ADC_PSSI) = 1 << sequencer;
+        }
+        return 0;
+    }
+
+    for (i = 0; i < count; ++i) {
+        snapshot->values[i] = (oversample->sums[i] + oversample->offset) >> oversample->shift;
+        oversample->sums[i] = 0;
+    }
+    oversample->numSequences = 0;
+    return count;
+}
+
+/**
+ * @brief ADCFIFOCount returns the number of samples in a sequencer FIFO.
+ *
+ * @param moduleBase The base address of the ADC module.
+ * @param sequencer The ADCSequencer to check.
+ * @return The number of samples.
+ */
+static uint8_t ADCFIFOCount(uint32_t moduleBase, enum ADCSequencer sequencer) {
+    uint32_t status = GET_REG(moduleBase + ADC_SS0 + 0x020 * sequencer + ADC_SSFSTAT);
+    if (status & 0x1000) return ADCSequencerDepths[sequencer];
+
+    /* The head (HPTR) and tail (TPTR) pointers index the FIFO entries. */
+    return (((status >> 4) & 0xF) - (status & 0xF)) & (ADCSequencerDepths[sequencer] - 1);
+}
+
+/**
+ * @brief ADCFIFOClear discards every sample in a sequencer FIFO.
+ *
+ * @param moduleBase The base address of the ADC module.
+ * @param sequencer The ADCSequencer to clear.
+ */
+static void ADCFIFOClear(uint32_t moduleBase, enum ADCSequencer sequencer) {
+    uint32_t sequencerOffset = ADC_SS0 + 0x020 * sequencer;
     while (!(GET_REG(moduleBase + sequencerOffset + ADC_SSFSTAT) & 0x100)) {
-        GET_REG(moduleBase + sequencerOffset +  ADC_SSFIFO);
+        GET_REG(moduleBase + sequencerOffset + ADC_SSFIFO);
     }
+}
 
-    /* 1. Initiate sampling in the sample sequencers. */
-    GET_REG(moduleBase + ADC_PSSI) =  1 << sequencer;
+ADCSync_t ADCSyncInit(ADCSyncConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.sequencer <= ADC_SS_3);
+    assert(0 < config.numPairs && config.numPairs <= ADCSequencerDepths[config.sequencer]);
+    assert(config.trigger != ADC_TRIGGER_ALWAYS);
 
-    /* 2. Wait for flag that conversion is done. */
-    while ((GET_REG(moduleBase + ADC_RIS) & (1 << sequencer)) == 0) {}
+    /* 1. Set up the pins of each module in sequence order. ADCInit checks
+          the rest of the configuration. Both modules keep the default zero
+          phase offset. */
+    uint8_t module;
+    uint8_t i;
+    for (module = ADC_MODULE_0; module <= ADC_MODULE_1; ++module) {
+        for (i = 0; i < config.numPairs; ++i) {
+            ADCConfig_t adcConfig = {
+                .pin=config.pins[module][i],
+                .module=(enum ADCModule)module,
+                .sequencer=config.sequencer,
+                .position=(enum ADCSequencePosition)i,
+                .isNotEndSample=(i + 1 < config.numPairs),
+                .oversampling=config.oversampling,
+                .sampleRate=config.sampleRate,
+                .priority=config.priority,
+                .trigger=config.trigger,
+                .triggerPin=config.triggerPin,
+                .triggerPWMModule=config.triggerPWMModule
+            };
+            ADCInit(adcConfig);
+        }
+    }
 
-    /* 3. Read result from the FIFO. */
+    ADCSync_t sync = {
+        config.sequencer,
+        config.numPairs
+    };
+
+    return sync;
+}
+
+uint8_t ADCSyncSample(ADCSync_t sync, uint16_t pairs[16]) {
+    uint32_t sequencerOffset = ADC_SS0 + 0x020 * sync.sequencer;
+    uint32_t sequencerBit = 1 << sync.sequencer;
+
+    /* Both sequencers must be processor triggered and not interrupt driven. */
+    assert((GET_REG(ADC0_BASE + ADC_EMUX) & (0xF << (4 * sync.sequencer))) == 0);
+    assert((GET_REG(ADC1_BASE + ADC_EMUX) & (0xF << (4 * sync.sequencer))) == 0);
+    assert((GET_REG(ADC0_BASE + ADC_IM) & sequencerBit) == 0);
+    assert((GET_REG(ADC1_BASE + ADC_IM) & sequencerBit) == 0);
+
+    /* The FIFOs are paired entry by entry, so no position may go to a
+       comparator. */
+    assert(GET_REG(ADC0_BASE + sequencerOffset + ADC_SSOP) == 0);
+    assert(GET_REG(ADC1_BASE + sequencerOffset + ADC_SSOP) == 0);
+
+    /* 0. Clear both internal FIFOs beforehand. */
+    ADCFIFOClear(ADC0_BASE, sync.sequencer);
+    ADCFIFOClear(ADC1_BASE, sync.sequencer);
+
+    /* 1. Initiate both sequencers, holding them until the global sync
+          (SYNCWAIT), then release both at once (GSYNC). */
+    GET_REG(ADC0_BASE + ADC_PSSI) = 0x08000000 | sequencerBit;
+    GET_REG(ADC1_BASE + ADC_PSSI) = 0x08000000 | sequencerBit;
+    GET_REG(ADC0_BASE + ADC_PSSI) = 0x80000000;
+
+    /* 2. Wait for flags that both conversions are done. */
+    while ((GET_REG(ADC0_BASE + ADC_RIS) & sequencerBit) == 0) {}
+    while ((GET_REG(ADC1_BASE + ADC_RIS) & sequencerBit) == 0) {}
+
+    /* 3. Read results from both FIFOs, interleaved. */
     uint8_t i = 0;
-    for (; !(GET_REG(moduleBase + sequencerOffset + ADC_SSFSTAT) & 0x100) && i < 8; ++i) {
-        arr[i] = GET_REG(moduleBase + sequencerOffset +  ADC_SSFIFO) & 0xFFF;
+    for (; i < sync.numPairs; ++i) {
+        if (GET_REG(ADC0_BASE + sequencerOffset + ADC_SSFSTAT) & 0x100) break;
+        if (GET_REG(ADC1_BASE + sequencerOffset + ADC_SSFSTAT) & 0x100) break;
+        pairs[2 * i] = GET_REG(ADC0_BASE + sequencerOffset + ADC_SSFIFO) & 0xFFF;
+        pairs[2 * i + 1] = GET_REG(ADC1_BASE + sequencerOffset + ADC_SSFIFO) & 0xFFF;
     }
 
-    /* 4. Clear flag. ADC_ISC clear interrupt */
-    GET_REG(moduleBase + ADC_ISC) |= 1 << sequencer;
+    /* 4. Clear flags. */
+    GET_REG(ADC0_BASE + ADC_ISC) = sequencerBit;
+    GET_REG(ADC1_BASE + ADC_ISC) = sequencerBit;
+
+    return i;
+}
+
+void ADCSyncStreamStart(ADCSyncStreamConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.sync.sequencer <= ADC_SS_3);
+    assert(0 < config.sync.numPairs && config.sync.numPairs <= ADCSequencerDepths[config.sync.sequencer]);
+    assert(config.bufferA != NULL);
+    assert(config.bufferB != NULL);
+    assert(0 < config.bufferSize && config.bufferSize % (2 * config.sync.numPairs) == 0);
+    assert(config.streamTask != NULL);
+
+    enum ADCSequencer sequencer = config.sync.sequencer;
+    uint32_t sequencerBit = 1 << sequencer;
+
+    /* Both sequencers must be hardware triggered and not interrupt driven. */
+    assert(GET_REG(ADC0_BASE + ADC_EMUX) & (0xF << (4 * sequencer)));
+    assert(GET_REG(ADC1_BASE + ADC_EMUX) & (0xF << (4 * sequencer)));
+    assert((GET_REG(ADC0_BASE + ADC_IM) & sequencerBit) == 0);
+    assert((GET_REG(ADC1_BASE + ADC_IM) & sequencerBit) == 0);
+
+    /* The FIFOs are paired entry by entry, so no position may go to a
+       comparator. */
+    uint32_t sequencerOffset = ADC_SS0 + 0x020 * sequencer;
+    assert(GET_REG(ADC0_BASE + sequencerOffset + ADC_SSOP) == 0);
+    assert(GET_REG(ADC1_BASE + sequencerOffset + ADC_SSOP) == 0);
+
+    /* 1. Save the stream before any sequence can complete. */
+    struct ADCSyncStream * stream = &ADCSyncStreams[sequencer];
+    stream->buffers[0] = config.bufferA;
+    stream->buffers[1] = config.bufferB;
+    stream->bufferSize = config.bufferSize;
+    stream->numValues = 0;
+    stream->numPairs = config.sync.numPairs;
+    stream->isAlternate = false;
+    stream->streamTask = config.streamTask;
+
+    /* 2. Stop both sequencers and discard what they converted so far. */
+    GET_REG(ADC0_BASE + ADC_ACTSS) &= ~sequencerBit;
+    GET_REG(ADC1_BASE + ADC_ACTSS) &= ~sequencerBit;
+    ADCFIFOClear(ADC0_BASE, sequencer);
+    ADCFIFOClear(ADC1_BASE, sequencer);
+    GET_REG(ADC0_BASE + ADC_OSTAT) = sequencerBit;
+    GET_REG(ADC1_BASE + ADC_OSTAT) = sequencerBit;
+    GET_REG(ADC1_BASE + ADC_ISC) = sequencerBit;
+
+    /* 3. Restart ADC_MODULE_1 first. A trigger landing in between then only
+          gives ADC_MODULE_1 an extra sequence, which the handler detects. */
+    GET_REG(ADC1_BASE + ADC_ACTSS) |= sequencerBit;
+    GET_REG(ADC0_BASE + ADC_ACTSS) |= sequencerBit;
+
+    /* 4. Arm the ADC_MODULE_1 sequencer interrupt and enable its IRQ in the
+          NVIC. Both sequences complete together, so it handles both. */
+    GET_REG(ADC1_BASE + ADC_IM) |= sequencerBit;
+    uint8_t IRQ = ADCInterruptSettings[ADC_MODULE_1][sequencer];
+    GET_REG(PERIPHERALS_BASE + NVIC_EN0_OFFSET + 4 * (IRQ >> 5)) = 1 << (IRQ & 31);
+}
+
+void ADCSyncStreamStop(ADCSync_t sync) {
+    /* 1. Disarm the ADC_MODULE_1 sequencer interrupt. */
+    GET_REG(ADC1_BASE + ADC_IM) &= ~(1 << sync.sequencer);
+    ADCSyncStreams[sync.sequencer].streamTask = NULL;
+}
+
+/**
+ * @brief ADCComparatorControl builds the DCCTL value of a comparator: the
+ *        interrupt is enabled (CIE) for a band (CIC) in a mode (CIM).
+ *
+ * @param event The crossings that interrupt.
+ * @param isHigh The current state, for ADC_DC_EVENT_BOTH.
+ * @return The DCCTL value.
+ */
+static uint32_t ADCComparatorControl(enum ADCComparatorEvent event, bool isHigh) {
+    /* Rising and falling use the Hysteresis-Once mode, which interrupts once
+       on entering the high (or low) band after having been in the other, and
+       is rearmed by entering the other band again. */
+    if (event == ADC_DC_EVENT_RISING) return 0x10 | (0x3 << 2) | 0x3;
+    if (event == ADC_DC_EVENT_FALLING) return 0x10 | (0x0 << 2) | 0x3;
+
+    /* Both interrupts once on entering the band opposite to the current
+       state. The handler flips the band after every crossing. */
+    return 0x10 | ((isHigh ? 0x0 : 0x3) << 2) | 0x1;
+}
+
+ADCComparator_t ADCComparatorInit(ADCComparatorConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.adc.module <= ADC_MODULE_1);
+    assert(config.adc.sequencer <= ADC_SS_3);
+    assert(config.adc.position <= ADC_SEQPOS_7);
+    assert(config.lowThreshold <= config.highThreshold);
+    assert(config.highThreshold <= 4095);
+    assert(config.event <= ADC_DC_EVENT_FALLING);
+
+    enum ADCModule module = config.adc.module;
+    enum ADCSequencer sequencer = config.adc.sequencer;
+
+    /* Streams read the FIFO as is, so their positions cannot be routed away
+       from it. */
+    assert(ADCStreams[module][sequencer].streamTask == NULL);
+    assert(ADCSyncStreams[sequencer].streamTask == NULL);
+    uint32_t moduleBase = !module * ADC0_BASE + module * ADC1_BASE;
+    uint32_t sequencerOffset = ADC_SS0 + 0x020 * sequencer;
+
+    /* 1. Assign the next free comparator. */
+    uint8_t comparator = 0;
+    while (comparator < ADC_NUM_COMPARATORS && ADCComparators[module][comparator].isUsed) {
+        ++comparator;
+    }
+    assert(comparator < ADC_NUM_COMPARATORS);
+
+    struct ADCComparatorSettings * settings = &ADCComparators[module][comparator];
+    settings->comparatorTask = config.comparatorTask;
+    settings->comparatorArgs = config.comparatorArgs;
+    settings->event = config.event;
+    settings->isHigh = false;
+    settings->isUsed = true;
+
+    /* 2. Disable sample sequencer. */
+    GET_REG(moduleBase + ADC_ACTSS) &= ~(1 << sequencer);
+
+    /* 3. Set the thresholds, COMP0 and COMP1. */
+    GET_REG(moduleBase + ADC_DCCMP + 4 * comparator) =
+        config.lowThreshold | (config.highThreshold << 16);
+
+    /* 4. Set the interrupt band and mode. */
+    GET_REG(moduleBase + ADC_DCCTL + 4 * comparator) =
+        ADCComparatorControl(config.event, false);
+
+    /* 5. Reset the comparator and clear its flag. */
+    GET_REG(moduleBase + ADC_DCRIC) = 0x10001 << comparator;
+    GET_REG(moduleBase + ADC_DCISC) = 1 << comparator;
+
+    /* 6. Route the sample to the comparator instead of the FIFO. */
+    GET_REG(moduleBase + sequencerOffset + ADC_SSDC) &= ~(0xF << (4 * config.adc.position));
+    GET_REG(moduleBase + sequencerOffset + ADC_SSDC) |= comparator << (4 * config.adc.position);
+    GET_REG(moduleBase + sequencerOffset + ADC_SSOP) |= 1 << (4 * config.adc.position);
+
+    /* 7. Reenable ADCACTSS. */
+    GET_REG(moduleBase + ADC_ACTSS) |= 1 << sequencer;
+
+    /* 8. Route the comparator interrupts to the sequencer interrupt (DCONSS)
+          and enable its IRQ in the NVIC. */
+    GET_REG(moduleBase + ADC_IM) |= 0x10000 << sequencer;
+    uint8_t IRQ = ADCInterruptSettings[module][sequencer];
+    GET_REG(PERIPHERALS_BASE + NVIC_EN0_OFFSET + 4 * (IRQ >> 5)) = 1 << (IRQ & 31);
+
+    ADCComparator_t adcComparator = {
+        module,
+        comparator
+    };
+
+    return adcComparator;
 }
 
-void ADC0Seq0_Handler(void) {
+bool ADCComparatorIsHigh(ADCComparator_t comparator) {
+    return ADCComparators[comparator.module][comparator.comparator].isHigh;
 }
 
-void ADC0Seq1_Handler(void) {
+/**
+ * @brief ADCComparatorHandler handles the crossings of every flagged
+ *        comparator of a module.
+ *
+ * @param module The ADCModule that interrupted.
+ */
+static void ADCComparatorHandler(enum ADCModule module) {
+    uint32_t moduleBase = !module * ADC0_BASE + module * ADC1_BASE;
+
+    /* 1. Acknowledge the flagged comparators before rearming them, so a
+          crossing during the handler interrupts again. */
+    uint32_t status = GET_REG(moduleBase + ADC_DCISC) & 0xFF;
+    GET_REG(moduleBase + ADC_DCISC) = status;
+
+    uint8_t comparator;
+    for (comparator = 0; comparator < ADC_NUM_COMPARATORS; ++comparator) {
+        if ((status & (1 << comparator)) == 0) continue;
+        struct ADCComparatorSettings * settings = &ADCComparators[module][comparator];
+
+        /* 2. Update the state, and for ADC_DC_EVENT_BOTH, wait for the
+              opposite band from now on. */
+        if (settings->event == ADC_DC_EVENT_BOTH) {
+            settings->isHigh = !settings->isHigh;
+            GET_REG(moduleBase + ADC_DCCTL + 4 * comparator) =
+                ADCComparatorControl(ADC_DC_EVENT_BOTH, settings->isHigh);
+            GET_REG(moduleBase + ADC_DCRIC) = 1 << comparator;
+        } else {
+            settings->isHigh = settings->event == ADC_DC_EVENT_RISING;
+        }
+
+        /* 3. Call the user function. */
+        if (settings->comparatorTask != NULL) {
+            settings->comparatorTask(settings->isHigh, settings->comparatorArgs);
+        }
+    }
 }
+
+/**
+ * @brief ADCStreamHandler hands each completed buffer of a streaming
+ *        sequencer to its task, oldest first, and rearms it.
+ *
+ * @param module The ADCModule that interrupted.
+ * @param sequencer The ADCSequencer that interrupted.
+ */
+static void ADCStreamHandler(enum ADCModule module, enum ADCSequencer sequencer) {
+    uint32_t moduleBase = !module * ADC0_BASE + module * ADC1_BASE;
+    uint32_t sequencerOffset = ADC_SS0 + 0x020 * sequencer;
+    volatile void * fifo = (volatile void *)(moduleBase + sequencerOffset + ADC_SSFIFO);
+    struct ADCStream * stream = &ADCStreams[module][sequencer];
+
+    DMAChannelClearInterrupt(stream->channel);
+
+    /* 1. Hand over and rearm completed buffers. The sequence interrupts in
+          between buffer completions fall through. */
+    while (DMATransferGetMode(stream->channel, stream->isAlternate) == DMA_MODE_STOP) {
+        uint16_t * buffer = stream->buffers[stream->isAlternate];
+        stream->streamTask(buffer, stream->bufferSize);
+        DMATransferSet(stream->channel, stream->isAlternate, DMA_MODE_PINGPONG, fifo, buffer, stream->bufferSize);
+        stream->isAlternate = !stream->isAlternate;
+    }
+
+    /* 2. If both buffers completed before one was rearmed, the uDMA disabled
+          the channel and samples were lost. Resume with the oldest buffer,
+          which the uDMA also selects next. */
+    if (!DMAChannelIsEnabled(stream->channel)) {
+        ADCRings[module][sequencer].dropped++;
+        DMAChannelEnable(stream->channel);
+    }
+}
+
+/**
+ * @brief ADCSyncStreamHandler moves every completed pair of sequences of a
+ *        synchronized stream into its buffer, handing over each filled
+ *        buffer.
+ *
+ * @param sequencer The ADCSequencer that interrupted on ADC_MODULE_1.
+ */
+static void ADCSyncStreamHandler(enum ADCSequencer sequencer) {
+    uint32_t sequencerOffset = ADC_SS0 + 0x020 * sequencer;
+    struct ADCSyncStream * stream = &ADCSyncStreams[sequencer];
+    uint8_t numPairs = stream->numPairs;
+
+    /* 1. A late handler overflows both FIFOs alike, possibly splitting a
+          sequence. Restart both from empty and count the loss. */
+    if (GET_REG(ADC1_BASE + ADC_OSTAT) & (1 << sequencer)) {
+        ADCFIFOClear(ADC0_BASE, sequencer);
+        ADCFIFOClear(ADC1_BASE, sequencer);
+        GET_REG(ADC0_BASE + ADC_OSTAT) = 1 << sequencer;
+        GET_REG(ADC1_BASE + ADC_OSTAT) = 1 << sequencer;
+        ADCRings[ADC_MODULE_1][sequencer].dropped++;
+        return;
+    }
+
+    /* 2. Interleave each completed sequence into the buffer. */
+    while (ADCFIFOCount(ADC1_BASE, sequencer) >= numPairs) {
+        /* ADC_MODULE_0 converts at the same time, so a sequence it lacks was
+           triggered while the stream started. */
+        if (ADCFIFOCount(ADC0_BASE, sequencer) < numPairs) {
+            ADCFIFOClear(ADC1_BASE, sequencer);
+            ADCRings[ADC_MODULE_1][sequencer].dropped++;
+            return;
+        }
+
+        uint16_t * buffer = stream->buffers[stream->isAlternate];
+        uint16_t * pair = buffer + stream->numValues;
+        uint8_t i;
+        for (i = 0; i < numPairs; ++i) {
+            pair[2 * i] = GET_REG(ADC0_BASE + sequencerOffset + ADC_SSFIFO) & 0xFFF;
+            pair[2 * i + 1] = GET_REG(ADC1_BASE + sequencerOffset + ADC_SSFIFO) & 0xFFF;
+        }
+
+        /* 3. Hand over a filled buffer and continue in the other. */
+        stream->numValues += 2 * numPairs;
+        if (stream->numValues == stream->bufferSize) {
+            stream->numValues = 0;
+            stream->isAlternate = !stream->isAlternate;
+            stream->streamTask(buffer, stream->bufferSize / 2);
+        }
+    }
+}
+
+/**
+ * @brief ADCHandler drains a sequencer FIFO into the sequencer's snapshot
+ *        and ring.
+ *
+ * @param module The ADCModule that interrupted.
+ * @param sequencer The ADCSequencer that interrupted.
+ */
+static void ADCHandler(enum ADCModule module, enum ADCSequencer sequencer) {
+    uint32_t moduleBase = !module * ADC0_BASE + module * ADC1_BASE;
+    struct ADCRing * ring = &ADCRings[module][sequencer];
+
+    /* 1. Handle digital comparator crossings routed to this sequencer
+          (DCINSS). */
+    uint32_t status = GET_REG(moduleBase + ADC_ISC);
+    uint64_t timestamp = 0;
+    if (ADCIsTimestamped && !ADCIsSnapshotOnly[module][sequencer] && (status & (1 << sequencer))) {
+        timestamp = ADCGetTimestamp();
+    }
+    if (status & (0x10000 << sequencer)) {
+        ADCComparatorHandler(module);
+        GET_REG(moduleBase + ADC_ISC) = 0x10000 << sequencer;
+    }
+
+    /* 2. Acknowledge the interrupt. ISC is write one to clear. */
+    GET_REG(moduleBase + ADC_ISC) = 1 << sequencer;
+
+    if (ADCStreams[module][sequencer].streamTask != NULL) {
+        ADCStreamHandler(module, sequencer);
+        return;
+    }
+
+    if (module == ADC_MODULE_1 && ADCSyncStreams[sequencer].streamTask != NULL) {
+        ADCSyncStreamHandler(sequencer);
+        return;
+    }
+
+    /* A comparator only interrupt has no frame. */
+    if ((status & (1 << sequencer)) == 0) return;
+
+    /* 3. Drain the FIFO into the sequencer's snapshot and publish it. An
+          oversampling sequencer publishes once per batch instead. */
+    struct ADCSnapshot * snapshot = &ADCSnapshots[module][sequencer];
+    uint8_t count = 0;
+    if (ADCOversamples[module][sequencer].numPerOutput != 0) {
+        count = ADCOversampleAccumulate(module, sequencer, snapshot);
+        if (count == 0) return;
+    } else {
+        count = ADCSequenceRead(moduleBase, sequencer, snapshot->values);
+    }
+    snapshot->count = count;
+    snapshot->generation++;
+
+    /* A snapshot only sequencer has no frame consumer. */
+    if (ADCIsSnapshotOnly[module][sequencer]) return;
+
+    /* 4. Drop the frame if the consumer has fallen behind. */
+    uint8_t head = ring->head;
+    if ((uint8_t)(head - ring->tail) >= ADC_RING_DEPTH) {
+        ring->dropped++;
+        return;
+    }
+
+    /* 5. Copy the snapshot and timestamp into the next frame, then publish
+          it. */
+    volatile ADCFrame_t * frame = &ring->frames[head & (ADC_RING_DEPTH - 1)];
+    frame->timestamp = timestamp;
+    uint8_t i;
+    for (i = 0; i < count; ++i) {
+        frame->values[i] = snapshot->values[i];
+    }
+    frame->count = count;
+    ring->head = head + 1;
+}
+
+void ADC0Seq0_Handler(void) { ADCHandler(ADC_MODULE_0, ADC_SS_0); }
+void ADC0Seq1_Handler(void) { ADCHandler(ADC_MODULE_0, ADC_SS_1); }
+void ADC0Seq2_Handler(void) { ADCHandler(ADC_MODULE_0, ADC_SS_2); }
+void ADC0Seq3_Handler(void) { ADCHandler(ADC_MODULE_0, ADC_SS_3); }
+void ADC1Seq0_Handler(void) { ADCHandler(ADC_MODULE_1, ADC_SS_0); }
+void ADC1Seq1_Handler(void) { ADCHandler(ADC_MODULE_1, ADC_SS_1); }
+void ADC1Seq2_Handler(void) { ADCHandler(ADC_MODULE_1, ADC_SS_2); }
+void ADC1Seq3_Handler(void) { ADCHandler(ADC_MODULE_1, ADC_SS_3); }
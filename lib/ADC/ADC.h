@@ -6,9 +6,59 @@
  * @date 2021-09-22
  * @copyright Copyright (c) 2021
  * @note
- * Unsupported Features. This driver does not support DMA control. This driver
- * does not support different trigger sources or interrupts. The driver does not
- * support configurable sample sequencer priorities.
+ * Unsupported Features. This driver does not support the analog comparator
+ * trigger sources. The driver does not support configurable sample sequencer
+ * priorities.
+ * @note
+ * Sequencers can be sampled in two ways:
+ * - Blocking. ADCSampleSingle and ADCSampleSequencer trigger the sequencer
+ *   and busy wait on the raw interrupt flag.
+ * - Interrupt driven. ADCStartSequencer arms the sequencer interrupt and
+ *   triggers it without waiting. On completion, the sequencer handler drains
+ *   the FIFO into a per sequencer single producer, single consumer ring of
+ *   ADC_RING_DEPTH frames. ADCTryRead pops the oldest frame, if any. Neither
+ *   side disables interrupts: the handler only writes the ring head and
+ *   ADCTryRead only writes the ring tail. If the ring is full, the handler
+ *   drops the new frame and counts it (ADCGetDroppedCount).
+ * Once a sequencer has been started, the blocking functions must not be used
+ * on it, since its handler consumes the FIFO.
+ * @note
+ * Both ways keep a snapshot of the latest sequence of each sequencer.
+ * ADCSampleSnapshot serves the pins of the sequencer from it, converting a
+ * new sequence only when asked to.
+ * @note
+ * A sequencer with a hardware trigger (see ADCTrigger) is started by the
+ * hardware at the trigger rate, without jitter from the CPU. ADCStartSequencer
+ * then only arms its interrupt, and the software wakes up once per completed
+ * sequence to collect the frame.
+ * @note
+ * For sustained high rate capture, ADCStreamStart streams a hardware
+ * triggered sequencer into two caller owned buffers with the uDMA in ping-pong
+ * mode. While the uDMA fills one buffer, the other is handed to a callback
+ * from the sequencer handler and then rearmed, so no sample is lost as long
+ * as the callback returns before the other buffer fills. The CPU never reads
+ * the FIFO.
+ * @note
+ * For sample timing, ADCTimestampInit starts a free running 64 bit wide timer.
+ * The sequencer handler stamps each frame it publishes to a ring with it, and
+ * ADCTryReadTimestamped returns the stamp with the frame. Consumers can then
+ * use the true time between samples instead of the nominal rate, and measure
+ * the sampling jitter.
+ * @note
+ * For resolution beyond 12 bits, ADCOversampleStart has a started sequencer
+ * sum batches of dithered sequences in its handler and publish them
+ * decimated, as 13 - 16 bit frames.
+ * @note
+ * For thresholding, ADCComparatorInit routes a sample to one of the eight
+ * digital comparators of its module instead of the FIFO. The comparator
+ * checks every conversion in hardware and interrupts only when the sample
+ * crosses its thresholds, so a hardware triggered boolean sensor costs no CPU
+ * time until its state changes.
+ * @note
+ * For phase aligned measurements, such as current and voltage, ADCSyncInit
+ * sets up the same sequencer on both modules and starts both on one event.
+ * Results are returned as interleaved pairs by ADCSyncSample or streamed
+ * with ADCSyncStreamStart.
  */
 
 #pragma once
@@ -18,8 +68,14 @@
 
 /** Device specific imports. */
 #include <lib/GPIO/GPIO.h>
+#include <lib/DMA/DMA.h>
+#include <lib/Timer/Timer.h>
 
 
+/** @brief Number of frames buffered per sequencer by the interrupt driven
+ *         API. Must be a power of two. */
+#define ADC_RING_DEPTH 4
+
 /** @brief ADCPin is an enumeration that specifies one of the available ADC pins
  *         on the TM4C. */
 enum ADCPin {
@@ -101,6 +157,28 @@ enum ADCPhase {
     ADC_PHASE_337_5
 };
 
+/** @brief ADCSampleRate is an enumeration specifying the maximum conversion
+ *         rate of an ADCModule, in samples per second. */
+enum ADCSampleRate {
+    ADC_RATE_125K,
+    ADC_RATE_250K,
+    ADC_RATE_500K,
+    ADC_RATE_1M
+};
+
+/** @brief ADCTrigger is an enumeration specifying the event that starts a
+ *         sequencer. The values are the EMUX field encodings. */
+enum ADCTrigger {
+    ADC_TRIGGER_PROCESSOR = 0x0,
+    ADC_TRIGGER_GPIO = 0x4,
+    ADC_TRIGGER_TIMER = 0x5,
+    ADC_TRIGGER_PWM_GEN_0 = 0x6,
+    ADC_TRIGGER_PWM_GEN_1 = 0x7,
+    ADC_TRIGGER_PWM_GEN_2 = 0x8,
+    ADC_TRIGGER_PWM_GEN_3 = 0x9,
+    ADC_TRIGGER_ALWAYS = 0xF
+};
+
 /** @brief ADCConfig_t is a user defined struct that specifies an ADC pin
  *         configuration. */
 typedef struct ADCConfig {
@@ -163,6 +241,8 @@ typedef struct ADCConfig {
      *        at the expense of power and more processing time. 
      *
      * Default ADC_AVG_NONE.
+     *
+     * @note Averaging does not add resolution. See ADCOversampleStart.
      */
     enum ADCAveraging oversampling;
 
@@ -184,22 +264,163 @@ typedef struct ADCConfig {
      */
     enum ADCPhase phase;
 
-    /** ------------- Unimplemented Fields. ------------- */
+    /**
+     * @brief The maximum conversion rate of the ADC module. Higher rates use
+     *        more power. The rate is shared by every sequencer of the module.
+     *
+     * Default ADC_RATE_125K.
+     */
+    enum ADCSampleRate sampleRate;
+
+    /**
+     * @brief Sequencer interrupt priority, used once the sequencer is started
+     *        with ADCStartSequencer. From 0 - 7. Lower value is higher
+     *        priority.
+     *
+     * Default is 0 (Highest priority).
+     */
+    uint8_t priority;
 
     /**
-     * Trigger source for the ADC sample sequencer.
-     * Default source is SW.
-     * Analog Comparators and PWM are by default disabled and will fault.
+     * @brief The event that starts the sequencer. The trigger is shared by
+     *        every position of the sequencer.
+     *
+     * - ADC_TRIGGER_PROCESSOR. Started by the sampling functions.
+     * - ADC_TRIGGER_GPIO. Started by a rising edge on triggerPin.
+     * - ADC_TRIGGER_TIMER. Started by the timeout of any timer initialized
+     *   with isADCTrigger set.
+     * - ADC_TRIGGER_PWM_GEN_X. Started each time the counter of PWM generator
+     *   X of triggerPWMModule reaches zero, once per PWM period.
+     * - ADC_TRIGGER_ALWAYS. Restarted as soon as the sequence completes.
+     *
+     * Default ADC_TRIGGER_PROCESSOR.
+     *
+     * @note The timer, PWM generator or GPIO pin must be initialized before
+     *       the ADC. A hardware triggered sequencer should be read with
+     *       ADCStartSequencer and ADCTryRead.
      */
-    // enum ADCTrigger { SW, AC0=0, AC1=0, GPIO=4, Timer=5, PWM0=0, PWM1=0, PWM2=0, PWM3=0, ALWAYS=0xF } trigger;
+    enum ADCTrigger trigger;
 
     /**
-     * Interrupt control.
-     * Default NULL (no interrupt).
+     * @brief The pin whose rising edge starts the sequencer. Only used by
+     *        ADC_TRIGGER_GPIO. The pin is configured as an edge sensitive
+     *        trigger, but its GPIO interrupt is not armed.
+     *
+     * Default PIN_A0.
      */
-    // void (*ADCHandler)(void);
+    GPIOPin_t triggerPin;
+
+    /**
+     * @brief The PWM module, 0 or 1, of the generator that starts the
+     *        sequencer. Only used by ADC_TRIGGER_PWM_GEN_X.
+     *
+     * Default 0.
+     */
+    uint8_t triggerPWMModule;
+
+    /**
+     * @brief Whether the sequencer handler only publishes the snapshot read
+     *        by ADCSampleSnapshot, and skips the frame ring of the sequencer.
+     *        ADCTryRead then never returns a frame, and no frames are counted
+     *        as dropped. Shared by every position of the sequencer.
+     *
+     * Default false.
+     */
+    bool isSnapshotOnly;
 } ADCConfig_t;
 
+/** @brief ADCStreamConfig_t is a user defined struct that specifies an ADC
+ *         stream configuration. */
+typedef struct ADCStreamConfig {
+    /**
+     * @brief The ADC module of the sequencer to stream.
+     *
+     * Default ADC_MODULE_0.
+     */
+    enum ADCModule module;
+
+    /**
+     * @brief The sequencer to stream. It must already be initialized with a
+     *        hardware trigger.
+     *
+     * Default ADC_SS_0.
+     */
+    enum ADCSequencer sequencer;
+
+    /**
+     * @brief The two caller owned buffers filled in turn, each holding
+     *        bufferSize samples. Samples of a multi position sequence are
+     *        interleaved in sequence order.
+     */
+    uint16_t * bufferA;
+    uint16_t * bufferB;
+
+    /**
+     * @brief The number of samples per buffer, from 1 - DMA_MAX_TRANSFER_SIZE.
+     *        A multiple of the sequence length keeps each buffer aligned to
+     *        whole sequences.
+     */
+    uint16_t bufferSize;
+
+    /**
+     * @brief Pointer to function called from the sequencer handler with each
+     *        filled buffer. The buffer is rearmed once the function returns.
+     *
+     * @note The function must return before the other buffer fills.
+     */
+    void (*streamTask)(uint16_t * buffer, uint16_t numSamples);
+} ADCStreamConfig_t;
+
+/** @brief ADCOversampleConfig_t is a user defined struct that specifies an
+ *         oversampling and decimation configuration. */
+typedef struct ADCOversampleConfig {
+    /**
+     * @brief The ADC module of the sequencer to oversample.
+     *
+     * Default ADC_MODULE_0.
+     */
+    enum ADCModule module;
+
+    /**
+     * @brief The sequencer to oversample. It must already be initialized.
+     *
+     * Default ADC_SS_0.
+     */
+    enum ADCSequencer sequencer;
+
+    /**
+     * @brief The number of bits of resolution added to each position of the
+     *        sequence, from 1 - 4, giving 13 - 16 bit results. Each result is
+     *        decimated from 4^extraBits conversions.
+     *
+     * Default is 0, which is invalid.
+     */
+    uint8_t extraBits;
+
+    /** ------------- Optional Fields. ------------- */
+
+    /**
+     * @brief Whether to leave the module's dithering as configured by
+     *        ADCInit. Decimation only recovers extra bits when the
+     *        quantization error varies between conversions, so dithering is
+     *        enabled by default.
+     *
+     * Default is false (Dithering is enabled).
+     */
+    bool isNotDithered;
+} ADCOversampleConfig_t;
+
+/** @brief Number of digital comparators in each ADCModule. */
+#define ADC_NUM_COMPARATORS 8
+
+/** @brief ADCComparatorEvent is an enumeration specifying which threshold
+ *         crossings of a digital comparator call its task. */
+enum ADCComparatorEvent {
+    ADC_DC_EVENT_BOTH,
+    ADC_DC_EVENT_RISING,
+    ADC_DC_EVENT_FALLING
+};
+
 /** @brief ADC_t is a struct containing user relevant data of an ADC. */
 typedef struct ADC {
     /**
@@ -219,6 +440,191 @@ typedef struct ADC {
     enum ADCSequencePosition position;
 } ADC_t;
 
+/** @brief ADCComparatorConfig_t is a user defined struct that specifies a
+ *         digital comparator configuration. */
+typedef struct ADCComparatorConfig {
+    /**
+     * @brief The ADC sample to compare, as returned by ADCInit. The sample no
+     *        longer reaches the sequencer FIFO.
+     */
+    ADC_t adc;
+
+    /**
+     * @brief The thresholds, from [0, 4095], with lowThreshold <=
+     *        highThreshold. The comparator goes high once a sample is at or
+     *        above highThreshold, and goes low once a sample is below
+     *        lowThreshold. The gap between them is the hysteresis.
+     *
+     * Default is 0 for both.
+     */
+    uint16_t lowThreshold;
+    uint16_t highThreshold;
+
+    /** ------------- Optional Fields. ------------- */
+
+    /**
+     * @brief The crossings that call comparatorTask.
+     * - ADC_DC_EVENT_BOTH. Every change of state. The comparator starts low,
+     *   so a sample that is already high calls the task once.
+     * - ADC_DC_EVENT_RISING. Only low to high changes, once per crossing.
+     *   Samples that stay high do not interrupt again until the sample has
+     *   been low.
+     * - ADC_DC_EVENT_FALLING. Only high to low changes, once per crossing.
+     *   Samples that stay low do not interrupt again until the sample has
+     *   been high.
+     *
+     * Default ADC_DC_EVENT_BOTH.
+     */
+    enum ADCComparatorEvent event;
+
+    /**
+     * @brief Pointer to function called from the sequencer handler on a
+     *        crossing, with the new state of the comparator.
+     *
+     * Default is NULL (No function defined). The state can still be read with
+     * ADCComparatorIsHigh.
+     */
+    void (*comparatorTask)(bool isHigh, uint32_t * args);
+
+    /**
+     * @brief The pointer to an array of uint32_t arguments that fed into
+     *        comparatorTask upon being called.
+     *
+     * Default is NULL (No pointer to any arguments is defined).
+     */
+    uint32_t * comparatorArgs;
+} ADCComparatorConfig_t;
+
+/** @brief ADCComparator_t is a struct containing user relevant data of a
+ *         digital comparator. */
+typedef struct ADCComparator {
+    /** @brief The ADCModule of the comparator. */
+    enum ADCModule module;
+
+    /** @brief The comparator, from 0 - ADC_NUM_COMPARATORS - 1. */
+    uint8_t comparator;
+} ADCComparator_t;
+
+/** @brief ADCSyncConfig_t is a user defined struct that specifies the same
+ *         sequencer on both ADC modules, sampling pairs of pins together. */
+typedef struct ADCSyncConfig {
+    /**
+     * @brief The pins of each pair, in sequence order. pins[0][i] is sampled
+     *        by ADC_MODULE_0 at the same instant pins[1][i] is sampled by
+     *        ADC_MODULE_1.
+     *
+     * Default is AIN0 for every pin.
+     */
+    enum ADCPin pins[2][8];
+
+    /**
+     * @brief The number of pairs, up to the number of positions of the
+     *        sequencer.
+     *
+     * Default is 0, which is invalid.
+     */
+    uint8_t numPairs;
+
+    /** ------------- Optional Fields. ------------- */
+
+    /**
+     * @brief The sequencer used on both modules. The sequencer is taken over
+     *        on both modules.
+     *
+     * Default ADC_SS_0.
+     */
+    enum ADCSequencer sequencer;
+
+    /**
+     * @brief The event that starts both sequencers. GPIO, timer and PWM
+     *        triggers are routed to both modules, so both start on the same
+     *        event. ADC_TRIGGER_PROCESSOR starts both with the global sync
+     *        (GSYNC) of ADCSyncSample. ADC_TRIGGER_ALWAYS is not supported,
+     *        as the modules would drift apart.
+     *
+     * Default ADC_TRIGGER_PROCESSOR.
+     */
+    enum ADCTrigger trigger;
+
+    /**
+     * @brief The pin whose rising edge starts the sequencers. Only used by
+     *        ADC_TRIGGER_GPIO.
+     *
+     * Default PIN_A0.
+     */
+    GPIOPin_t triggerPin;
+
+    /**
+     * @brief The PWM module, 0 or 1, of the generator that starts the
+     *        sequencers. Only used by ADC_TRIGGER_PWM_GEN_X.
+     *
+     * Default 0.
+     */
+    uint8_t triggerPWMModule;
+
+    /**
+     * @brief The hardware sample averaging of both modules.
+     *
+     * Default ADC_AVG_NONE.
+     */
+    enum ADCAveraging oversampling;
+
+    /**
+     * @brief The maximum conversion rate of both modules.
+     *
+     * Default ADC_RATE_125K.
+     */
+    enum ADCSampleRate sampleRate;
+
+    /**
+     * @brief Interrupt priority of the ADC_MODULE_1 sequencer, which handles
+     *        streams. From 0 - 7. Lower value is higher priority.
+     *
+     * Default is 0 (Highest priority).
+     */
+    uint8_t priority;
+} ADCSyncConfig_t;
+
+/** @brief ADCSync_t is a struct containing user relevant data of a pair of
+ *         synchronized sequencers. */
+typedef struct ADCSync {
+    /** @brief The sequencer used on both modules. */
+    enum ADCSequencer sequencer;
+
+    /** @brief The number of pairs in each sequence. */
+    uint8_t numPairs;
+} ADCSync_t;
+
+/** @brief ADCSyncStreamConfig_t is a user defined struct that specifies a
+ *         synchronized stream configuration. */
+typedef struct ADCSyncStreamConfig {
+    /** @brief The synchronized sequencers to stream. They must have a
+     *         hardware trigger. */
+    ADCSync_t sync;
+
+    /**
+     * @brief The two caller owned buffers filled in turn, each holding
+     *        bufferSize values. Each pair is stored as the ADC_MODULE_0 value
+     *        followed by the ADC_MODULE_1 value, in sequence order.
+     */
+    uint16_t * bufferA;
+    uint16_t * bufferB;
+
+    /**
+     * @brief The number of values per buffer. Must be a multiple of
+     *        2 * numPairs, so each buffer holds whole sequences.
+     */
+    uint16_t bufferSize;
+
+    /**
+     * @brief Pointer to function called from the sequencer handler with each
+     *        filled buffer. Filling continues in the other buffer.
+     *
+     * @note The function must return before the other buffer fills.
+     */
+    void (*streamTask)(uint16_t * buffer, uint16_t numPairs);
+} ADCSyncStreamConfig_t;
+
 
 /**
  * @brief ADCInit initializes an ADC module given an ADCConfig_t configuration.
@@ -251,8 +657,8 @@ bool ADCIsFull(enum ADCModule module, enum ADCSequencer sequencer);
 /**
  * @brief ADCSampleSingle samples a single ADC pin. This may be slower if the
  *        sequencer is configured to capture other samples, as this method
- *        cycles through the internal sample FIFO to capture the wanted value
- *        and throw out the others.
+ *        converts the whole sequence to capture the wanted value. The other
+ *        values are kept in the sequencer's snapshot, see ADCSampleSnapshot.
  *
  * @param adc The ADC object containing the pin value that should be sampled.
  * @return A single uint16_t representing the pin ADC value sampled.
@@ -270,3 +676,234 @@ uint16_t ADCSampleSingle(ADC_t adc);
  * @param arr A reference to an array to fill with values.
  */
 void ADCSampleSequencer(enum ADCModule module, enum ADCSequencer sequencer, uint16_t arr[8]);
+
+/**
+ * @brief ADCSampleSnapshot reads a single ADC pin from the latest sequence
+ *        converted by its sequencer. Every blocking sample and every frame
+ *        drained by the sequencer handler updates the snapshot, so reading
+ *        all the pins of a sequencer costs one conversion of the sequence
+ *        instead of one per pin.
+ *
+ * @param adc The ADC object containing the pin value that should be read.
+ * @param isFresh Whether to convert a new sequence first. If the sequencer
+ *        has been started, waits for its handler to publish the next
+ *        sequence instead. A new sequence is always converted if there is no
+ *        snapshot yet.
+ * @return A single uint16_t representing the pin ADC value.
+ * @note Must not be used on a streaming sequencer.
+ */
+uint16_t ADCSampleSnapshot(ADC_t adc, bool isFresh);
+
+/**
+ * @brief ADCGetSnapshotGeneration returns the number of sequences published
+ *        to the snapshot of a sequencer. A caller can compare it to a value
+ *        it saw earlier to tell whether the snapshot has changed since.
+ *
+ * @param module The ADCModule to check.
+ * @param sequencer The ADCSequencer to check.
+ * @return The generation of the snapshot. 0 if no snapshot has been taken.
+ */
+uint32_t ADCGetSnapshotGeneration(enum ADCModule module, enum ADCSequencer sequencer);
+
+/**
+ * @brief ADCStartSequencer arms the sequencer interrupt and, if the sequencer
+ *        uses ADC_TRIGGER_PROCESSOR, triggers a sample of the sequencer. Does
+ *        not wait for the conversion. The result is read later with
+ *        ADCTryRead. A hardware triggered sequencer only needs to be started
+ *        once.
+ *
+ * @param module The ADCModule to execute.
+ * @param sequencer The ADCSequencer to sequence.
+ */
+void ADCStartSequencer(enum ADCModule module, enum ADCSequencer sequencer);
+
+/**
+ * @brief ADCTryRead pops the oldest completed frame of a started sequencer.
+ *        Does not block and does not disable interrupts.
+ *
+ * @param module The ADCModule to read.
+ * @param sequencer The ADCSequencer to read.
+ * @param arr A reference to an array to fill with values.
+ * @return The number of values written to arr, up to 8. 0 if no frame is
+ *         available.
+ */
+uint8_t ADCTryRead(enum ADCModule module, enum ADCSequencer sequencer, uint16_t arr[8]);
+
+/**
+ * @brief ADCGetDroppedCount returns the number of frames of a started
+ *        sequencer that were dropped because its ring was full. Always 0
+ *        for a snapshot only sequencer. For a
+ *        streaming sequencer, returns the number of times both buffers filled
+ *        before the handler could rearm one, losing samples. For the
+ *        ADC_MODULE_1 sequencer of a synchronized stream, returns the number
+ *        of times sequences were discarded to keep the pairs aligned.
+ *
+ * @param module The ADCModule to check.
+ * @param sequencer The ADCSequencer to check.
+ * @return The number of dropped frames.
+ */
+uint32_t ADCGetDroppedCount(enum ADCModule module, enum ADCSequencer sequencer);
+
+/**
+ * @brief ADCTimestampInit starts a free running wide timer, concatenated to 64
+ *        bits, and stamps every frame published to the sequencer rings from
+ *        then on with the time its sequencer handler ran.
+ *
+ * @param timer The wide timer to use, from WTIMER_0A - WTIMER_5A. Its B side
+ *        is used as well.
+ * @note Timestamps are in clock cycles (MAX_FREQ) and do not wrap.
+ */
+void ADCTimestampInit(TimerID_t timer);
+
+/**
+ * @brief ADCGetTimestamp returns the current time of the timestamp timer, on
+ *        the same scale as the frame timestamps.
+ *
+ * @return The time since ADCTimestampInit, in clock cycles.
+ */
+uint64_t ADCGetTimestamp(void);
+
+/**
+ * @brief ADCTryReadTimestamped pops the oldest completed frame of a started
+ *        sequencer, like ADCTryRead, along with the time it completed.
+ *
+ * @param module The ADCModule to read.
+ * @param sequencer The ADCSequencer to read.
+ * @param arr A reference to an array to fill with values.
+ * @param timestamp A reference to fill with the timestamp of the frame, in
+ *        clock cycles. 0 if the frame was published before ADCTimestampInit.
+ * @return The number of values written to arr, up to 8. 0 if no frame is
+ *         available.
+ */
+uint8_t ADCTryReadTimestamped(
+    enum ADCModule module,
+    enum ADCSequencer sequencer,
+    uint16_t arr[8],
+    uint64_t * timestamp
+);
+
+/**
+ * @brief ADCStreamStart continuously streams a hardware triggered sequencer
+ *        into two buffers with the uDMA, calling streamTask as each fills.
+ *        bufferA is filled first.
+ *
+ * @param config The configuration of the stream.
+ * @note The sequencer must not have been started with ADCStartSequencer.
+ */
+void ADCStreamStart(ADCStreamConfig_t config);
+
+/**
+ * @brief ADCStreamStop stops a streaming sequencer. Samples in the partially
+ *        filled buffer are discarded.
+ *
+ * @param module The ADCModule to stop.
+ * @param sequencer The ADCSequencer to stop.
+ */
+void ADCStreamStop(enum ADCModule module, enum ADCSequencer sequencer);
+
+/**
+ * @brief ADCOversampleStart makes a sequencer publish each position of the
+ *        sequence decimated from 4^extraBits conversions, then starts it like
+ *        ADCStartSequencer. The sequencer handler sums the sequences and
+ *        publishes one frame per batch to ADCTryRead and ADCSampleSnapshot.
+ *        A processor triggered sequencer is restarted by its handler until
+ *        the batch is complete, so each ADCStartSequencer yields one frame.
+ *
+ * @param config The configuration of the oversampling.
+ * @note Hardware averaging set with ADCConfig_t.oversampling counts towards
+ *       the 4^extraBits conversions, but may cover at most 2^extraBits of
+ *       them, since it truncates its average to 12 bits. Its average must
+ *       still vary by an LSB or more, so only use it on noisy inputs.
+ */
+void ADCOversampleStart(ADCOversampleConfig_t config);
+
+/**
+ * @brief ADCOversampleStop stops an oversampling sequencer. The partially
+ *        summed batch is discarded.
+ *
+ * @param module The ADCModule to stop.
+ * @param sequencer The ADCSequencer to stop.
+ */
+void ADCOversampleStop(enum ADCModule module, enum ADCSequencer sequencer);
+
+/**
+ * @brief ADCComparatorInit assigns the next free digital comparator of the
+ *        sample's module to the sample and arms its interrupt on the sample's
+ *        sequencer. The interrupt priority is the sequencer's.
+ *
+ * @param config The configuration of the comparator.
+ * @return An ADCComparator_t struct instance.
+ * @note Best used with a hardware triggered sequencer. The sequencer does not
+ *       need to be started. The sample no longer reaches the FIFO, so its
+ *       position reads 0 and the other positions keep their place. Cannot be
+ *       used on a streamed or synchronized sequencer, which read the FIFO as
+ *       is.
+ */
+ADCComparator_t ADCComparatorInit(ADCComparatorConfig_t config);
+
+/**
+ * @brief ADCComparatorIsHigh returns the last state of an ADC_DC_EVENT_BOTH
+ *        comparator, without sampling. For the other events, returns the
+ *        state of the last crossing.
+ *
+ * @param comparator The comparator to check.
+ * @return If the comparator is high.
+ */
+bool ADCComparatorIsHigh(ADCComparator_t comparator);
+
+/**
+ * @brief ADCSyncInit sets up the same sequencer on both ADC modules to sample
+ *        pairs of pins on the same trigger. Both modules are set to the same
+ *        rate, averaging and a zero phase offset, so each pair is converted
+ *        at the same instant.
+ *
+ * @param config The configuration of the synchronized sequencers.
+ * @return An ADCSync_t struct instance.
+ * @note Reconfigures module wide settings of both modules, such as the
+ *       sample rate and phase, for every other sequencer as well.
+ */
+ADCSync_t ADCSyncInit(ADCSyncConfig_t config);
+
+/**
+ * @brief ADCSyncSample starts both sequencers together with a global sync
+ *        and busy waits for both sequences.
+ *
+ * @param sync The synchronized sequencers to sample. Must use
+ *        ADC_TRIGGER_PROCESSOR.
+ * @param pairs A reference to an array to fill with interleaved pairs, the
+ *        ADC_MODULE_0 value first.
+ * @return The number of pairs written to pairs.
+ */
+uint8_t ADCSyncSample(ADCSync_t sync, uint16_t pairs[16]);
+
+/**
+ * @brief ADCSyncStreamStart continuously fills two buffers with the
+ *        interleaved pairs of hardware triggered synchronized sequencers,
+ *        calling streamTask as each fills. bufferA is filled first.
+ *
+ * @param config The configuration of the stream.
+ * @note The ADC_MODULE_1 sequencer interrupts once per sequence and drains
+ *       both FIFOs. Sequences lost to a late interrupt are counted by
+ *       ADCGetDroppedCount on ADC_MODULE_1. For rates beyond a few tens of
+ *       thousands of sequences per second, stream each module with
+ *       ADCStreamStart instead; both buffers stay sample aligned.
+ */
+void ADCSyncStreamStart(ADCSyncStreamConfig_t config);
+
+/**
+ * @brief ADCSyncStreamStop stops a synchronized stream. Pairs in the
+ *        partially filled buffer are discarded.
+ *
+ * @param sync The synchronized sequencers to stop.
+ */
+void ADCSyncStreamStop(ADCSync_t sync);
+
+/** Handler declarations for the sample sequencers. */
+void ADC0Seq0_Handler(void);
+void ADC0Seq1_Handler(void);
+void ADC0Seq2_Handler(void);
+void ADC0Seq3_Handler(void);
+void ADC1Seq0_Handler(void);
+void ADC1Seq1_Handler(void);
+void ADC1Seq2_Handler(void);
+void ADC1Seq3_Handler(void);
@@ -0,0 +1,278 @@
+/**
+ * @file ADCScheduler.c
+ * @author agent (agent@local)
+ * @brief Packs ADC channels sampled at a rate onto shared sequencers.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ */
+
+/** General imports. */
+#include <stdbool.h>
+#include <assert.h>
+
+/** Device specific imports. */
+#include <inc/RegDefs.h>
+#include <lib/ADC/ADCScheduler.h>
+
+
+/** @brief Number of sequencers across both modules. */
+#define ADC_SCHEDULER_NUM_SEQUENCERS 8
+
+/** @brief ADCSchedulerChannels holds each channel request and, once started,
+ *         the sequence position that serves it. */
+static struct ADCSchedulerChannel {
+    enum ADCPin pin;
+    uint32_t frequency;
+    uint16_t divider;
+    ADC_t adc;
+} ADCSchedulerChannels[ADC_SCHEDULER_MAX_CHANNELS];
+
+static uint8_t ADCSchedulerNumChannels = 0;
+
+/**
+ * @brief ADCSchedulerSequencers is the pacing state of each sequencer, indexed
+ *        by 4 * module + sequencer. The sequencer is started every divider
+ *        ticks. A divider of 0 marks an unused sequencer.
+ */
+static struct ADCSchedulerSequencer {
+    uint16_t divider;
+    uint16_t countdown;
+} ADCSchedulerSequencers[ADC_SCHEDULER_NUM_SEQUENCERS];
+
+/** @brief Number of positions of each sequencer. */
+static const uint8_t ADCSchedulerDepths[4] = {8, 4, 4, 1};
+
+/** @brief Frequency of the pacing timer, in hz. 0 until started. */
+static uint32_t ADCSchedulerBaseFrequency = 0;
+
+/**
+ * @brief ADCSchedulerTick is the pacing timer task. It starts every sequencer
+ *        that is due, with one PSSI write per module.
+ *
+ * @param args Unused.
+ */
+static void ADCSchedulerTick(uint32_t * args) {
+    uint32_t starts[2] = {0, 0};
+    uint8_t i;
+    for (i = 0; i < ADC_SCHEDULER_NUM_SEQUENCERS; ++i) {
+        struct ADCSchedulerSequencer * sequencer = &ADCSchedulerSequencers[i];
+        if (sequencer->divider == 0) continue;
+        if (--sequencer->countdown == 0) {
+            sequencer->countdown = sequencer->divider;
+            starts[i >> 2] |= 1 << (i & 3);
+        }
+    }
+
+    if (starts[ADC_MODULE_0]) GET_REG(ADC0_BASE + ADC_PSSI) = starts[ADC_MODULE_0];
+    if (starts[ADC_MODULE_1]) GET_REG(ADC1_BASE + ADC_PSSI) = starts[ADC_MODULE_1];
+}
+
+/**
+ * @brief ADCSchedulerFindSequencer picks the free sequencer for the next part
+ *        of a group of channels: the smallest one that holds all of them, or
+ *        else the largest one. Ties go to the module with fewer positions in
+ *        use, so both modules convert in parallel.
+ *
+ * @param numRemaining The number of channels of the group left to place.
+ * @param isFree Whether each sequencer is free.
+ * @param load The number of positions in use on each module.
+ * @return The index of the sequencer, 4 * module + sequencer.
+ */
+static uint8_t ADCSchedulerFindSequencer(
+    uint8_t numRemaining,
+    const bool isFree[ADC_SCHEDULER_NUM_SEQUENCERS],
+    const uint8_t load[2]
+) {
+    int8_t best = -1;
+    uint8_t i;
+    for (i = 0; i < ADC_SCHEDULER_NUM_SEQUENCERS; ++i) {
+        if (!isFree[i]) continue;
+        if (best == -1) {
+            best = i;
+            continue;
+        }
+
+        uint8_t depth = ADCSchedulerDepths[i & 3];
+        uint8_t bestDepth = ADCSchedulerDepths[best & 3];
+        bool isFit = depth >= numRemaining;
+        bool isBestFit = bestDepth >= numRemaining;
+        if (isFit != isBestFit) {
+            if (isFit) best = i;
+        } else if (depth != bestDepth) {
+            if (isFit == (depth < bestDepth)) best = i;
+        } else if (load[i >> 2] < load[best >> 2]) {
+            best = i;
+        }
+    }
+
+    assert(best != -1);
+    return (uint8_t)best;
+}
+
+ADCChannel_t ADCSchedulerAddChannel(ADCChannelConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.pin <= AIN11);
+    assert(1 <= config.frequency && config.frequency <= ADC_SCHEDULER_MAX_FREQUENCY);
+    assert(ADCSchedulerNumChannels < ADC_SCHEDULER_MAX_CHANNELS);
+    assert(ADCSchedulerBaseFrequency == 0);
+
+    ADCSchedulerChannels[ADCSchedulerNumChannels].pin = config.pin;
+    ADCSchedulerChannels[ADCSchedulerNumChannels].frequency = config.frequency;
+
+    ADCChannel_t channel = {
+        ADCSchedulerNumChannels++
+    };
+
+    return channel;
+}
+
+void ADCSchedulerStart(ADCSchedulerConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.timer < SYSTICK);
+    assert(config.priority <= 7);
+    assert(0 < ADCSchedulerNumChannels);
+    assert(ADCSchedulerBaseFrequency == 0);
+
+    /* 1. The fastest channel sets the base rate. Round every channel to a
+          whole divider of it. */
+    uint32_t base = 0;
+    uint8_t i;
+    for (i = 0; i < ADCSchedulerNumChannels; ++i) {
+        if (ADCSchedulerChannels[i].frequency > base) {
+            base = ADCSchedulerChannels[i].frequency;
+        }
+    }
+    for (i = 0; i < ADCSchedulerNumChannels; ++i) {
+        uint32_t frequency = ADCSchedulerChannels[i].frequency;
+        ADCSchedulerChannels[i].divider = (base + frequency / 2) / frequency;
+    }
+
+    bool isFree[ADC_SCHEDULER_NUM_SEQUENCERS];
+    for (i = 0; i < ADC_SCHEDULER_NUM_SEQUENCERS; ++i) {
+        isFree[i] = !(config.reservedSequencers & (1 << i));
+    }
+    uint8_t load[2] = {0, 0};
+    bool isPlaced[ADC_SCHEDULER_MAX_CHANNELS] = {false};
+
+    /* 2. Place the groups of channels sharing a divider, largest group
+          first, so the largest groups get the deepest sequencers. */
+    while (true) {
+        /* Find the divider of the largest unplaced group. A pin requested
+           twice is counted once. */
+        uint8_t groupSize = 0;
+        uint16_t divider = 0;
+        for (i = 0; i < ADCSchedulerNumChannels; ++i) {
+            if (isPlaced[i]) continue;
+            uint8_t size = 0;
+            uint8_t j;
+            for (j = i; j < ADCSchedulerNumChannels; ++j) {
+                if (isPlaced[j] || ADCSchedulerChannels[j].divider != ADCSchedulerChannels[i].divider) continue;
+                uint8_t k = i;
+                while (k < j && (isPlaced[k] ||
+                    ADCSchedulerChannels[k].divider != ADCSchedulerChannels[j].divider ||
+                    ADCSchedulerChannels[k].pin != ADCSchedulerChannels[j].pin)) ++k;
+                if (k == j) ++size;
+            }
+            if (size > groupSize) {
+                groupSize = size;
+                divider = ADCSchedulerChannels[i].divider;
+            }
+        }
+        if (groupSize == 0) break;
+
+        /* Fill sequencers with the group's pins, in request order. */
+        uint8_t numRemaining = groupSize;
+        i = 0;
+        while (numRemaining > 0) {
+            uint8_t index = ADCSchedulerFindSequencer(numRemaining, isFree, load);
+            enum ADCModule module = (enum ADCModule)(index >> 2);
+            enum ADCSequencer sequencer = (enum ADCSequencer)(index & 3);
+            uint8_t numPositions = ADCSchedulerDepths[sequencer];
+            if (numPositions > numRemaining) numPositions = numRemaining;
+
+            uint8_t position;
+            for (position = 0; position < numPositions; ++position) {
+                /* Next unplaced channel of the group. */
+                while (isPlaced[i] || ADCSchedulerChannels[i].divider != divider) ++i;
+
+                ADCConfig_t adcConfig = {
+                    .pin=ADCSchedulerChannels[i].pin,
+                    .module=module,
+                    .sequencer=sequencer,
+                    .position=(enum ADCSequencePosition)position,
+                    .isNotEndSample=(position + 1 < numPositions),
+                    .priority=config.priority,
+                    .isSnapshotOnly=true
+                };
+                ADC_t adc = ADCInit(adcConfig);
+
+                /* Serve every request of the pin in the group from it. */
+                uint8_t j;
+                for (j = i; j < ADCSchedulerNumChannels; ++j) {
+                    if (isPlaced[j] || ADCSchedulerChannels[j].divider != divider) continue;
+                    if (ADCSchedulerChannels[j].pin != adc.pin) continue;
+                    ADCSchedulerChannels[j].adc = adc;
+                    isPlaced[j] = true;
+                }
+            }
+
+            isFree[index] = false;
+            load[module] += numPositions;
+            ADCSchedulerSequencers[index].divider = divider;
+            ADCSchedulerSequencers[index].countdown = divider;
+            numRemaining -= numPositions;
+        }
+    }
+
+    /* 3. Arm every used sequencer. This also converts its first sequence. */
+    for (i = 0; i < ADC_SCHEDULER_NUM_SEQUENCERS; ++i) {
+        if (ADCSchedulerSequencers[i].divider == 0) continue;
+        ADCStartSequencer((enum ADCModule)(i >> 2), (enum ADCSequencer)(i & 3));
+    }
+
+    /* 4. Start the pacing timer. */
+    ADCSchedulerBaseFrequency = base;
+    TimerConfig_t timerConfig = {
+        .timerID=config.timer,
+        .period=freqToPeriod(base, MAX_FREQ),
+        .timerTask=ADCSchedulerTick,
+        .isPeriodic=true,
+        .priority=config.priority
+    };
+    TimerInit(timerConfig);
+}
+
+uint16_t ADCSchedulerRead(ADCChannel_t channel) {
+    /* Initialization asserts. */
+    assert(ADCSchedulerBaseFrequency != 0);
+    assert(channel.index < ADCSchedulerNumChannels);
+
+    return ADCSampleSnapshot(ADCSchedulerChannels[channel.index].adc, false);
+}
+
+uint32_t ADCSchedulerGetGeneration(ADCChannel_t channel) {
+    /* Initialization asserts. */
+    assert(ADCSchedulerBaseFrequency != 0);
+    assert(channel.index < ADCSchedulerNumChannels);
+
+    ADC_t adc = ADCSchedulerChannels[channel.index].adc;
+    return ADCGetSnapshotGeneration(adc.module, adc.sequencer);
+}
+
+uint32_t ADCSchedulerGetFrequency(ADCChannel_t channel) {
+    /* Initialization asserts. */
+    assert(ADCSchedulerBaseFrequency != 0);
+    assert(channel.index < ADCSchedulerNumChannels);
+
+    return ADCSchedulerBaseFrequency / ADCSchedulerChannels[channel.index].divider;
+}
+
+uint8_t ADCSchedulerGetNumSequencers(void) {
+    uint8_t numSequencers = 0;
+    uint8_t i;
+    for (i = 0; i < ADC_SCHEDULER_NUM_SEQUENCERS; ++i) {
+        if (ADCSchedulerSequencers[i].divider != 0) ++numSequencers;
+    }
+    return numSequencers;
+}
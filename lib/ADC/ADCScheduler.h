@@ -0,0 +1,160 @@
+/**
+ * @file ADCScheduler.h
+ * @author agent (agent@local)
+ * @brief Packs ADC channels sampled at a rate onto shared sequencers.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note
+ * Consumers, such as sensors, request a pin sampled at a frequency with
+ * ADCSchedulerAddChannel instead of claiming a module and sequencer of their
+ * own. ADCSchedulerStart then packs every requested channel onto the fewest
+ * sequencers of both modules and starts them:
+ * - The fastest requested frequency becomes the base rate of a single timer.
+ *   Every other frequency is rounded to the base rate divided by a whole
+ *   number, its divider.
+ * - Channels sharing a divider share sequencers, filled in sequence order. A
+ *   pin requested twice at the same divider is sampled once.
+ * - Each group of channels takes the smallest free sequencer that holds all
+ *   of its remaining channels, or else the largest free one, until it is
+ *   placed.
+ * - On each timer tick, every sequencer that is due is started with one PSSI
+ *   write per module. The sequencer handler publishes each sequence to the
+ *   snapshot of the sequencer, and channels read their position from it.
+ *
+ * A single software paced timer is used because the ADC timer trigger is
+ * shared by every timer triggered sequencer, so hardware triggers cannot pace
+ * sequencers at different rates.
+ *
+ * Scheduled sequencers are snapshot only: their handlers skip the frame rings,
+ * so ADCTryRead and ADCGetDroppedCount do not apply to them.
+ */
+#pragma once
+
+/** General imports. */
+#include <stdint.h>
+
+/** Device specific imports. */
+#include <lib/ADC/ADC.h>
+#include <lib/Timer/Timer.h>
+
+
+/** @brief Maximum number of channels that can be requested. Both modules hold
+ *         26 sequence positions in total. */
+#define ADC_SCHEDULER_MAX_CHANNELS 26
+
+/** @brief Maximum frequency of a channel, in hz. Bounds the timer interrupt
+ *         rate. */
+#define ADC_SCHEDULER_MAX_FREQUENCY 10000
+
+/** @brief ADCChannelConfig_t is a user defined struct that specifies a
+ *         channel request. */
+typedef struct ADCChannelConfig {
+    /**
+     * @brief The pin to sample.
+     *
+     * Default is AIN0, which corresponds to PE3.
+     */
+    enum ADCPin pin;
+
+    /**
+     * @brief The sample frequency of the channel, in hz, from 1 -
+     *        ADC_SCHEDULER_MAX_FREQUENCY. The frequency is rounded to the base
+     *        rate divided by a whole number.
+     *
+     * Default is 0, which is invalid.
+     */
+    uint32_t frequency;
+} ADCChannelConfig_t;
+
+/** @brief ADCChannel_t is a handle to a requested channel. */
+typedef struct ADCChannel {
+    /** @brief Index of the channel request. */
+    uint8_t index;
+} ADCChannel_t;
+
+/** @brief ADCSchedulerConfig_t is a user defined struct that specifies the
+ *         scheduler configuration. */
+typedef struct ADCSchedulerConfig {
+    /**
+     * @brief The timer used to pace the sequencers.
+     *
+     * Default is TIMER_0A.
+     */
+    TimerID_t timer;
+
+    /** ------------- Optional Fields. ------------- */
+
+    /**
+     * @brief Interrupt priority of the timer and of the sequencers. From 0 -
+     *        7. Lower value is higher priority.
+     *
+     * Default is 0 (Highest priority).
+     */
+    uint8_t priority;
+
+    /**
+     * @brief Sequencers the scheduler must not use, such as those used
+     *        directly by other drivers. Bit 4 * module + sequencer is set for
+     *        each reserved sequencer.
+     *
+     * Default is 0 (Every sequencer may be used).
+     */
+    uint8_t reservedSequencers;
+} ADCSchedulerConfig_t;
+
+/**
+ * @brief ADCSchedulerAddChannel requests a pin sampled at a frequency. The
+ *        channel is placed on a sequencer by ADCSchedulerStart.
+ *
+ * @param config The configuration of the channel.
+ * @return An ADCChannel_t handle used to read the channel.
+ * @note Must be called before ADCSchedulerStart.
+ */
+ADCChannel_t ADCSchedulerAddChannel(ADCChannelConfig_t config);
+
+/**
+ * @brief ADCSchedulerStart places every requested channel on a sequencer,
+ *        initializes the sequencers and starts the pacing timer.
+ *
+ * @param config The configuration of the scheduler.
+ * @note Asserts if the channels do not fit on the unreserved sequencers.
+ */
+void ADCSchedulerStart(ADCSchedulerConfig_t config);
+
+/**
+ * @brief ADCSchedulerRead returns the latest sample of a channel, without
+ *        converting. Waits for the first sequence of the channel if none has
+ *        completed yet.
+ *
+ * @param channel The channel to read.
+ * @return The latest sample of the channel.
+ */
+uint16_t ADCSchedulerRead(ADCChannel_t channel);
+
+/**
+ * @brief ADCSchedulerGetGeneration returns the number of sequences completed
+ *        by the sequencer of a channel. A consumer can compare it to a value
+ *        it saw earlier to tell whether a new sample is available.
+ *
+ * @param channel The channel to check.
+ * @return The generation of the channel's sequencer.
+ */
+uint32_t ADCSchedulerGetGeneration(ADCChannel_t channel);
+
+/**
+ * @brief ADCSchedulerGetFrequency returns the sample frequency of a channel
+ *        after rounding.
+ *
+ * @param channel The channel to check.
+ * @return The sample frequency, in hz.
+ */
+uint32_t ADCSchedulerGetFrequency(ADCChannel_t channel);
+
+/**
+ * @brief ADCSchedulerGetNumSequencers returns the number of sequencers used
+ *        by the scheduler.
+ *
+ * @return The number of sequencers used.
+ */
+uint8_t ADCSchedulerGetNumSequencers(void);
@@ -17,28 +17,18 @@
 #include <math.h>
 
 /** Device specific imports. */
-#include <inc/regDefs.h>
+#include <inc/RegDefs.h>
 #include <lib/DAC/DAC.h>
 
 
-/** @brief pinMap is a mapping of bit level registers to each GPIO pin. */
-static struct DACMap {
-    uint32_t address;
-} dacMap[PORT_COUNT] = {
-    0x40004000, // PA
-    0x40005000, // PB
-    0x40006000, // PC
-    0x40007000, // PD
-    0x40024000, // PE
-    0x40025000, // PF
-};
-
 DAC_t DACInit(DACConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.pins != NULL);
 
     /** For each specified pin. */
     uint8_t i;
     for (i = 0; i < config.numPins; ++i) {
-        assert(config.pins[i] != NULL);
+        assert(config.pins[i] < PIN_COUNT);
 
         /* Initialize pin. */
         GPIOConfig_t pinConfig = {
@@ -55,19 +45,21 @@ DAC_t DACInit(DACConfig_t config) {
 
     DAC_t dac = {
         .pins=config.pins,
-        .numPins=config.numPins
+        .numPins=config.numPins,
+        .group=GPIOPinGroupInit(config.pins, config.numPins)
     };
 
     return dac;
 }
 
 void DACOut(DAC_t dac, uint8_t data) {
+    /* 1. Move each bit of data to the bit of its pin in the port. */
+    uint8_t value = 0;
     uint8_t i;
     for (i = 0; i < dac.numPins; ++i) {
-		uint32_t addr = 
-			dacMap[(uint8_t)(dac.pins[i] / PINS_PER_PORT)].address + 
-			(0x4 << (dac.pins[i] % PINS_PER_PORT));
-		uint32_t value = ((data >> i) & 0x1) << (dac.pins[i] % PINS_PER_PORT);
-        GET_REG(addr) = value;
+        value |= ((data >> i) & 0x1) << (dac.pins[i] % PINS_PER_PORT);
     }
+
+    /* 2. Write every pin in one store. */
+    GPIOPinGroupWrite(dac.group, value);
 }
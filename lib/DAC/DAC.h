@@ -19,7 +19,8 @@
 typedef struct DACConfig {
     /** @brief pins is a pointer to an array defined by the user. It must be at
      *         least numPins length and each entry should be a valid GPIOPin_t
-     *         value, otherwise an internal assert will be executed.
+     *         value on the same port, otherwise an internal assert will be
+     *         executed.
      */
     GPIOPin_t * pins;
 
@@ -35,13 +36,17 @@ typedef struct DAC {
 
     /** @brief numPins is the number of pins specified for the DAC. */
     uint8_t numPins;
+
+    /** @brief The pins of the DAC, written together by DACOut. */
+    GPIOPinGroup_t group;
 } DAC_t;
 
 /**
- * DACInit initializes an N-bit DAC on Port B.
- * @param pins A list of pins to initialize, in order of LSB to MSB.
- * @note Assumes that the first pin that is invalid (PIN_COUNT) means all
- *       following pins are invalid. 
+ * DACInit initializes an N-bit DAC on a single port.
+ * @param config The pins to initialize, in order of LSB to MSB, and their
+ *        count.
+ * @note Only the first numPins pins are used. Each must be a valid pin
+ *       (below PIN_COUNT) on the same port as the others.
  *       Goes up to 6 bits of resolution. 
  *       Multiple DACs can be configured, but the user retains responsibility
  *       for managing the pins data structures.
@@ -49,10 +54,10 @@ typedef struct DAC {
 DAC_t DACInit(DACConfig_t config);
 
 /**
- * DACOut outputs data to the relevant DAC pins set by DACInit.
- * @param pins The list of pins to write data to, in order of LSB to MSB.
+ * DACOut outputs data to the relevant DAC pins set by DACInit. All pins
+ * change in a single store, so the output does not glitch through
+ * intermediate values.
+ * @param dac The DAC to write data to.
  * @param data A value from 0 - 255. Scaled based on how many bits are part of the DAC.
- * @note Assumes that the first pin that is invalid (PIN_COUNT) means all
- *       following pins are invalid. 
  */
 void DACOut(DAC_t dac, uint8_t data);
@@ -0,0 +1,144 @@
+/**
+ * @file DMA.c
+ * @author agent (agent@local)
+ * @brief Micro Direct Memory Access (uDMA) controller driver.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note
+ * Unsupported Features. This driver does not support the scatter-gather
+ * modes. This driver does not support software requests.
+ */
+
+/** General Imports. */
+#include <assert.h>
+
+/** Device specific imports. */
+#include <inc/RegDefs.h>
+#include <lib/DMA/DMA.h>
+
+
+/**
+ * @brief DMAControlTable holds the primary descriptors of the 32 channels,
+ *        followed by the alternate descriptors. Each descriptor is four words:
+ *        the source end pointer, the destination end pointer, the control word
+ *        and an unused word. The controller requires 1024 byte alignment.
+ */
+static volatile uint32_t DMAControlTable[256] __attribute__((aligned(1024)));
+
+/** @brief Indices of the words in a descriptor. */
+enum DMADescriptorWord {
+    DMA_SRC_END,
+    DMA_DST_END,
+    DMA_CONTROL
+};
+
+void DMAInit(void) {
+    /* 1. Activate the clock for uDMA and stall until ready. */
+    GET_REG(SYSCTL_BASE + SYSCTL_RCGCDMA_OFFSET) |= 0x1;
+    while ((GET_REG(SYSCTL_BASE + SYSCTL_PRDMA_OFFSET) & 0x1) == 0) {}
+
+    /* 2. Enable the controller. */
+    GET_REG(UDMA_BASE + UDMA_CFG_OFFSET) = 0x1;
+
+    /* 3. Point the controller to the channel control table. */
+    GET_REG(UDMA_BASE + UDMA_CTLBASE_OFFSET) = (uint32_t)DMAControlTable;
+}
+
+DMAChannel_t DMAChannelInit(DMAConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.channel < 32);
+    assert(config.encoding <= 4);
+    assert(config.itemSize <= DMA_SIZE_32);
+    assert(config.arbitrationSize <= DMA_ARB_1024);
+
+    uint32_t channelBit = 1 << config.channel;
+
+    /* 1. Disable the channel during setup. */
+    GET_REG(UDMA_BASE + UDMA_ENACLR_OFFSET) = channelBit;
+
+    /* 2. Select the peripheral driving the channel. Each map register holds
+          the 4 bit encodings of 8 channels. */
+    uint32_t mapAddr = UDMA_BASE + UDMA_CHMAP0_OFFSET + 4 * (config.channel >> 3);
+    GET_REG(mapAddr) &= ~(0xF << (4 * (config.channel & 7)));
+    GET_REG(mapAddr) |= config.encoding << (4 * (config.channel & 7));
+
+    /* 3. Use the primary descriptor first. */
+    GET_REG(UDMA_BASE + UDMA_ALTCLR_OFFSET) = channelBit;
+
+    /* 4. Set channel priority. */
+    if (config.isHighPriority) GET_REG(UDMA_BASE + UDMA_PRIOSET_OFFSET) = channelBit;
+    else GET_REG(UDMA_BASE + UDMA_PRIOCLR_OFFSET) = channelBit;
+
+    /* 5. Set which request types the channel responds to. */
+    if (config.isBurstOnly) GET_REG(UDMA_BASE + UDMA_USEBURSTSET_OFFSET) = channelBit;
+    else GET_REG(UDMA_BASE + UDMA_USEBURSTCLR_OFFSET) = channelBit;
+
+    /* 6. Allow the peripheral to make requests. */
+    GET_REG(UDMA_BASE + UDMA_REQMASKCLR_OFFSET) = channelBit;
+
+    /* 7. Build the descriptor control word fields that do not change between
+          transfers. An increment of 0x3 means no increment. */
+    uint32_t dstIncrement = config.isDestinationFixed ? 0x3 : config.itemSize;
+    uint32_t srcIncrement = config.isSourceFixed ? 0x3 : config.itemSize;
+    DMAChannel_t channel = {
+        config.channel,
+        (dstIncrement << 30) |
+        (config.itemSize << 28) |
+        (srcIncrement << 26) |
+        (config.itemSize << 24) |
+        (config.arbitrationSize << 14)
+    };
+
+    return channel;
+}
+
+void DMATransferSet(
+    DMAChannel_t channel,
+    bool isAlternate,
+    enum DMATransferMode mode,
+    volatile void * source,
+    volatile void * destination,
+    uint16_t numItems
+) {
+    /* Initialization asserts. */
+    assert(mode <= DMA_MODE_PINGPONG);
+    assert(0 < numItems && numItems <= DMA_MAX_TRANSFER_SIZE);
+
+    volatile uint32_t * descriptor = &DMAControlTable[4 * (channel.channel + 32 * isAlternate)];
+
+    /* 1. The controller addresses items backwards from the end pointers, so
+          point them at the last item of an incrementing address. */
+    uint32_t srcIncrement = (channel.control >> 26) & 0x3;
+    uint32_t dstIncrement = (channel.control >> 30) & 0x3;
+    uint32_t last = numItems - 1;
+    descriptor[DMA_SRC_END] = (uint32_t)source +
+        ((srcIncrement == 0x3) ? 0 : (last << srcIncrement));
+    descriptor[DMA_DST_END] = (uint32_t)destination +
+        ((dstIncrement == 0x3) ? 0 : (last << dstIncrement));
+
+    /* 2. Write the control word last, as it arms the descriptor. */
+    descriptor[DMA_CONTROL] = channel.control | (last << 4) | mode;
+}
+
+enum DMATransferMode DMATransferGetMode(DMAChannel_t channel, bool isAlternate) {
+    return (enum DMATransferMode)(
+        DMAControlTable[4 * (channel.channel + 32 * isAlternate) + DMA_CONTROL] & 0x7);
+}
+
+void DMAChannelEnable(DMAChannel_t channel) {
+    GET_REG(UDMA_BASE + UDMA_ENASET_OFFSET) = 1 << channel.channel;
+}
+
+void DMAChannelDisable(DMAChannel_t channel) {
+    GET_REG(UDMA_BASE + UDMA_ENACLR_OFFSET) = 1 << channel.channel;
+}
+
+bool DMAChannelIsEnabled(DMAChannel_t channel) {
+    return (GET_REG(UDMA_BASE + UDMA_ENASET_OFFSET) >> channel.channel) & 0x1;
+}
+
+void DMAChannelClearInterrupt(DMAChannel_t channel) {
+    /* CHIS is write one to clear. */
+    GET_REG(UDMA_BASE + UDMA_CHIS_OFFSET) = 1 << channel.channel;
+}
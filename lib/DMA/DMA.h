@@ -0,0 +1,220 @@
+/**
+ * @file DMA.h
+ * @author agent (agent@local)
+ * @brief Micro Direct Memory Access (uDMA) controller driver.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note
+ * The uDMA controller moves data between peripherals and memory without the
+ * CPU. Each of the 32 channels has a primary and an alternate descriptor in a
+ * channel control table owned by this driver. A descriptor describes a single
+ * transfer of up to DMA_MAX_TRANSFER_SIZE items. When a descriptor completes,
+ * its mode reads back as DMA_MODE_STOP and the peripheral's interrupt is
+ * signaled.
+ *
+ * In DMA_MODE_PINGPONG, the controller switches to the other descriptor of
+ * the channel when one completes, so software can refill a descriptor while
+ * the other is in use. If both descriptors complete before one is refilled,
+ * the controller disables the channel.
+ *
+ * Unsupported Features. This driver does not support the scatter-gather
+ * modes. This driver does not support software requests.
+ */
+#pragma once
+
+/** General imports. */
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/** @brief Maximum number of items in a single descriptor transfer. */
+#define DMA_MAX_TRANSFER_SIZE 1024
+
+/** @brief DMAItemSize is an enumeration specifying the size of each item
+ *         transferred. */
+enum DMAItemSize {
+    DMA_SIZE_8,
+    DMA_SIZE_16,
+    DMA_SIZE_32
+};
+
+/** @brief DMAArbitrationSize is an enumeration specifying the number of items
+ *         transferred before the controller rearbitrates between channels. */
+enum DMAArbitrationSize {
+    DMA_ARB_1,
+    DMA_ARB_2,
+    DMA_ARB_4,
+    DMA_ARB_8,
+    DMA_ARB_16,
+    DMA_ARB_32,
+    DMA_ARB_64,
+    DMA_ARB_128,
+    DMA_ARB_256,
+    DMA_ARB_512,
+    DMA_ARB_1024
+};
+
+/** @brief DMATransferMode is an enumeration specifying the transfer mode of a
+ *         descriptor. A completed descriptor reads back as DMA_MODE_STOP. */
+enum DMATransferMode {
+    DMA_MODE_STOP,
+    DMA_MODE_BASIC,
+    DMA_MODE_AUTO,
+    DMA_MODE_PINGPONG
+};
+
+/** @brief DMAConfig_t is a user defined struct that specifies a uDMA channel
+ *         configuration. */
+typedef struct DMAConfig {
+    /**
+     * @brief The uDMA channel, from 0 - 31. See Table 9-1 of the datasheet for
+     *        the peripheral assigned to each channel.
+     *
+     * Default is channel 0.
+     */
+    uint8_t channel;
+
+    /** ------------- Optional Fields. ------------- */
+
+    /**
+     * @brief The channel encoding, from 0 - 4, selecting which peripheral
+     *        drives the channel.
+     *
+     * Default is encoding 0.
+     */
+    uint8_t encoding;
+
+    /**
+     * @brief The size of each item, for both the source and the destination.
+     *
+     * Default DMA_SIZE_8.
+     */
+    enum DMAItemSize itemSize;
+
+    /**
+     * @brief Whether the source address stays fixed, such as a peripheral
+     *        FIFO, instead of incrementing by one item.
+     *
+     * Default is false (Incrementing).
+     */
+    bool isSourceFixed;
+
+    /**
+     * @brief Whether the destination address stays fixed instead of
+     *        incrementing by one item.
+     *
+     * Default is false (Incrementing).
+     */
+    bool isDestinationFixed;
+
+    /**
+     * @brief The number of items transferred per request before the
+     *        controller rearbitrates.
+     *
+     * Default DMA_ARB_1.
+     */
+    enum DMAArbitrationSize arbitrationSize;
+
+    /**
+     * @brief Whether the channel has high priority over other channels.
+     *
+     * Default is false (Default priority).
+     */
+    bool isHighPriority;
+
+    /**
+     * @brief Whether the channel only responds to burst requests from the
+     *        peripheral.
+     *
+     * Default is false (Single and burst requests).
+     */
+    bool isBurstOnly;
+} DMAConfig_t;
+
+/** @brief DMAChannel_t is a struct containing user relevant data of a uDMA
+ *         channel. */
+typedef struct DMAChannel {
+    /** @brief The uDMA channel. */
+    uint8_t channel;
+
+    /** @brief The size, increment and arbitration fields of the channel's
+     *         descriptors. */
+    uint32_t control;
+} DMAChannel_t;
+
+/**
+ * @brief DMAInit enables the uDMA controller and sets up its channel control
+ *        table. Safe to call more than once.
+ */
+void DMAInit(void);
+
+/**
+ * @brief DMAChannelInit configures a uDMA channel. The channel is left
+ *        disabled, using its primary descriptor.
+ *
+ * @param config The configuration of the channel.
+ * @return A DMAChannel_t struct instance used for transfers.
+ * @note Requires DMAInit to be called first.
+ */
+DMAChannel_t DMAChannelInit(DMAConfig_t config);
+
+/**
+ * @brief DMATransferSet sets up a descriptor of the channel for a transfer.
+ *
+ * @param channel The channel to set up.
+ * @param isAlternate Whether to set up the alternate instead of the primary
+ *        descriptor.
+ * @param mode The transfer mode. DMA_MODE_STOP disables the descriptor.
+ * @param source The address of the first item to read.
+ * @param destination The address of the first item to write.
+ * @param numItems The number of items, from 1 - DMA_MAX_TRANSFER_SIZE.
+ */
+void DMATransferSet(
+    DMAChannel_t channel,
+    bool isAlternate,
+    enum DMATransferMode mode,
+    volatile void * source,
+    volatile void * destination,
+    uint16_t numItems);
+
+/**
+ * @brief DMATransferGetMode returns the mode of a descriptor of the channel.
+ *
+ * @param channel The channel to check.
+ * @param isAlternate Whether to check the alternate instead of the primary
+ *        descriptor.
+ * @return The mode of the descriptor. DMA_MODE_STOP once it has completed.
+ */
+enum DMATransferMode DMATransferGetMode(DMAChannel_t channel, bool isAlternate);
+
+/**
+ * @brief DMAChannelEnable enables the channel, starting any set up transfer
+ *        on the next peripheral request.
+ *
+ * @param channel The channel to enable.
+ */
+void DMAChannelEnable(DMAChannel_t channel);
+
+/**
+ * @brief DMAChannelDisable disables the channel.
+ *
+ * @param channel The channel to disable.
+ */
+void DMAChannelDisable(DMAChannel_t channel);
+
+/**
+ * @brief DMAChannelIsEnabled checks whether the channel is enabled. The
+ *        controller disables a channel when it runs out of descriptors.
+ *
+ * @param channel The channel to check.
+ * @return If the channel is enabled.
+ */
+bool DMAChannelIsEnabled(DMAChannel_t channel);
+
+/**
+ * @brief DMAChannelClearInterrupt clears the completion flag of the channel.
+ *
+ * @param channel The channel to clear.
+ */
+void DMAChannelClearInterrupt(DMAChannel_t channel);
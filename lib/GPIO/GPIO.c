@@ -6,13 +6,36 @@
  * @date 2021-10-28
  * @copyright Copyright (c) 2021
  * @note
- * Fast Mode. Use optional compilation flag (1) or define a preprocessor macro
- * (2) in your project for compiling with GPIOSetBit(Fast) and GPIOGetBit(Fast).
- *      (1) `-D__FAST__`
- *      (2) `#define __FAST__ 1`
- * This is high recommended for programs using interrupts that call these
- * functions to edit GPIO bits, or for high frequency operation programs. There
- * is a tradeoff of on the order of 100x speedup vs 1KB more lines of DATA.
+ * Inline Access. GPIOSetBit and GPIOGetBit are defined inline in GPIO.h and
+ * access a pin through the DATA register alias masked to it, computed from the
+ * pin with shifts and adds only. For a pin known at compile time, the address
+ * folds into a constant and each call reduces to a single store or load.
+ *
+ * Port Access. GPIOPortWrite and GPIOPortRead access any subset of the pins of
+ * a port at once, through the address masked aliases of the DATA register:
+ * bits 9:2 of the address select the pins a store changes or a load returns.
+ * A multi-pin update is then a single store, so the pins change together. A
+ * GPIOPinGroup_t precomputes the alias of a fixed set of pins.
+ *
+ * Deferred Events. A pin initialized with isDeferred does not run its task in
+ * the port handler. The handler pushes a (pin, edge, timestamp) record into a
+ * single producer, single consumer queue of its port instead, and returns in
+ * constant time. The main loop, or a low priority task, pops the records with
+ * GPIOEventTryRead or runs their tasks with GPIOEventDispatch. Records are
+ * stamped from the free running timer started by GPIOTimestampInit. If a
+ * queue is full, the record is dropped and counted (GPIOEventGetDroppedCount).
+ *
+ * Debouncing. A pin initialized with a lockoutMs interrupts on both edges. An
+ * edge that changes the debounced state of the pin is accepted and reported
+ * as a press (touchTask) or release (releaseTask), and the interrupt of the
+ * pin is masked for lockoutMs, so its bounces do not interrupt at all. A
+ * single shared 1 ms tick, started by GPIODebounceInit, re-arms every pin
+ * whose window has passed. If the pin settled in the other state during the
+ * window, the change is accepted then. The tick also reports a long press
+ * (longPressTask) once a pin is held for longPressMs. Only pins locked out or
+ * held are visited on a tick, so one timer serves every pin. Edges that do not
+ * change the debounced state, and windows in which the pin bounced, are
+ * counted (GPIODebounceGetSuppressedCount).
  *
  * Unsupported Features. This driver does not support DMA control.
  */
@@ -58,7 +81,11 @@ static struct GPIOPortInterruptConfig {
     /* Port G and H technically exist, but we (the user) never use them directly. */
 };
 
-/** @brief GPIOInterruptSettings is a set of pin interrupt configurations. */
+/**
+ * @brief GPIOInterruptSettings is a set of pin interrupt configurations,
+ *        indexed by port and then by the bit of the pin in the port, so the
+ *        port handler dispatches straight from the bits of GPIO_MIS.
+ */
 static struct GPIOInterruptSettings {
     /** @brief User function associated with the rising edge interrupt. */
     void (*touchTask)(uint32_t *args);
@@ -74,7 +101,94 @@ static struct GPIOInterruptSettings {
 
     /** @brief The current pin status. */
     enum GPIOIntPinStatus pinStatus;
-} GPIOInterruptSettings[PIN_COUNT];
+
+    /** @brief Whether the tasks are deferred to GPIOEventDispatch. */
+    bool isDeferred;
+
+    /** @brief Lockout window after each accepted edge, in debounce ticks. 0 if
+     *         the pin is not debounced. */
+    uint16_t lockoutTicks;
+
+    /** @brief Whether the pin is pressed when low. */
+    bool isActiveLow;
+
+    /** @brief Time held before a long press, in debounce ticks. */
+    uint16_t longPressTicks;
+
+    /** @brief User function associated with a long press. */
+    void (*longPressTask)(uint32_t *args);
+
+    /** @brief User args associated with the long press function. */
+    uint32_t * longPressArgs;
+
+    /** @brief Debounce tick at which the lockout window ends. */
+    uint32_t lockoutEnd;
+
+    /** @brief Debounce tick at which the pin was pressed. */
+    uint32_t pressTick;
+} GPIOInterruptSettings[PORT_COUNT][PINS_PER_PORT];
+
+/**
+ * @brief GPIOEventQueue is a single producer, single consumer queue of edge
+ *        records for a port. The port handler is the only writer of head and
+ *        GPIOEventTryRead is the only writer of tail. Both are free running
+ *        and masked on access. A queue per port keeps a single producer even
+ *        when port handlers of different priorities preempt each other.
+ */
+static struct GPIOEventQueue {
+    volatile GPIOEvent_t events[GPIO_EVENT_QUEUE_DEPTH];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile uint32_t dropped;
+} GPIOEventQueues[PORT_COUNT];
+
+/** @brief GPIOTimestampTimer is the timer stamping edge records, if
+ *         GPIOIsTimestamped. */
+static Timer_t GPIOTimestampTimer;
+static bool GPIOIsTimestamped = false;
+
+/**
+ * @brief GPIOLockedPins are the debounced pins of each port masked during a
+ *        lockout window, and GPIOHeldPins are those pressed and waiting for a
+ *        long press. The debounce tick only visits these pins. Both are only
+ *        written at the debounce priority.
+ */
+static volatile uint8_t GPIOLockedPins[PORT_COUNT];
+static volatile uint8_t GPIOHeldPins[PORT_COUNT];
+
+/** @brief GPIODebounceTicks counts the debounce ticks since GPIODebounceInit. */
+static volatile uint32_t GPIODebounceTicks = 0;
+static volatile uint32_t GPIODebounceSuppressed = 0;
+static uint8_t GPIODebouncePriority = 0;
+static bool GPIOIsDebounced = false;
+
+/**
+ * @brief GPIOInterruptPorts are the ports with interrupt pins, as bits, and
+ *        GPIOInterruptPriorities their NVIC priority. GPIODebouncedPorts are
+ *        the ports with debounced pins. The NVIC priority is set per port, so
+ *        every interrupt pin of a debounced port must use the debounce
+ *        priority, or the port handler and the debounce tick could preempt
+ *        each other.
+ */
+static uint8_t GPIOInterruptPorts = 0;
+static uint8_t GPIODebouncedPorts = 0;
+static uint8_t GPIOInterruptPriorities[PORT_COUNT];
+
+/** @brief GPIOInterruptHook is the user function called on entry to and exit
+ *         from every port handler, if any. */
+static void (*GPIOInterruptHook)(GPIOPort_t port, uint8_t pins, bool isExit) = NULL;
+
+/**
+ * @brief GPIO_CLZ counts the leading zeros of a 32 bit word with the CLZ
+ *        instruction. Undefined for 0.
+ */
+#if defined(__ARMCC_VERSION)
+#define GPIO_CLZ(x) __clz(x)
+#elif defined(__TI_COMPILER_VERSION__)
+#define GPIO_CLZ(x) _norm(x)
+#else
+#define GPIO_CLZ(x) __builtin_clz(x)
+#endif
 
 GPIOPin_t GPIOInit(GPIOConfig_t config) {
     /* Initialization asserts. */
@@ -215,6 +329,15 @@ GPIOPin_t GPIOIntInit(GPIOConfig_t config, GPIOInterruptConfig_t intConfig) {
     /* Initialization asserts. */
     assert(intConfig.priority <= 7);
     assert(intConfig.pinStatus < RAISED);
+    assert(intConfig.lockoutMs == 0 ||
+        (GPIOIsDebounced && intConfig.priority == GPIODebouncePriority));
+    assert(intConfig.longPressMs == 0 || intConfig.lockoutMs != 0);
+    uint8_t portMask = 1 << (config.pin / PINS_PER_PORT);
+    bool isInterrupt = intConfig.touchTask || intConfig.releaseTask || intConfig.lockoutMs;
+    assert(!isInterrupt || !(GPIODebouncedPorts & portMask) ||
+        intConfig.priority == GPIODebouncePriority);
+    assert(intConfig.lockoutMs == 0 || !(GPIOInterruptPorts & portMask) ||
+        GPIOInterruptPriorities[config.pin / PINS_PER_PORT] == GPIODebouncePriority);
 
     /* 1. Generate the port offset to find the correct addresses.
           There are a couple components in this line:
@@ -252,10 +375,10 @@ GPIOPin_t GPIOIntInit(GPIOConfig_t config, GPIOInterruptConfig_t intConfig) {
     uint8_t pinAddress = 1 << config.pin % 8;
 
     /* 3. Enable interrupts if required. */
-    if (intConfig.touchTask || intConfig.releaseTask) {
+    if (isInterrupt) {
         /* 4. Set pin as edge sensitive. */
         GET_REG(GPIO_PORT_BASE + portOffset + GPIO_IS_OFFSET) &= ~pinAddress;
-        if (!intConfig.touchTask && !intConfig.releaseTask) {
+        if (intConfig.lockoutMs || (!intConfig.touchTask && !intConfig.releaseTask)) {
             /* 5. Set pin to interrupt on both edges. */
             GET_REG(GPIO_PORT_BASE + portOffset + GPIO_IBE_OFFSET) |= pinAddress;
         } else {
@@ -291,458 +414,426 @@ GPIOPin_t GPIOIntInit(GPIOConfig_t config, GPIOInterruptConfig_t intConfig) {
 
         /* 12. Enable IRQ X in NVIC. */
         (*GPIOPortInterruptConfig[ID].NVIC_EN_ADDR) = 1 << GPIOPortInterruptConfig[ID].IRQ;
+
+        /* Remember the port priority for later pins of the port. */
+        GPIOInterruptPorts |= portMask;
+        GPIOInterruptPriorities[ID] = intConfig.priority;
+        if (intConfig.lockoutMs) GPIODebouncedPorts |= portMask;
     }
 
     /* 13. Assign configuration to the internal data structure. */
-    GPIOInterruptSettings[config.pin].touchTask = intConfig.touchTask;
-    GPIOInterruptSettings[config.pin].touchArgs = intConfig.touchArgs;
-    GPIOInterruptSettings[config.pin].releaseTask = intConfig.releaseTask;
-    GPIOInterruptSettings[config.pin].releaseArgs = intConfig.releaseArgs;
+    struct GPIOInterruptSettings * settings =
+        &GPIOInterruptSettings[config.pin / PINS_PER_PORT][config.pin % PINS_PER_PORT];
+    settings->touchTask = intConfig.touchTask;
+    settings->touchArgs = intConfig.touchArgs;
+    settings->releaseTask = intConfig.releaseTask;
+    settings->releaseArgs = intConfig.releaseArgs;
+    settings->isDeferred = intConfig.isDeferred;
+    settings->pinStatus = intConfig.pinStatus;
+    settings->lockoutTicks = intConfig.lockoutMs;
+    settings->isActiveLow = intConfig.isActiveLow;
+    settings->longPressTicks = intConfig.longPressMs;
+    settings->longPressTask = intConfig.longPressTask;
+    settings->longPressArgs = intConfig.longPressArgs;
+
+    /* 14. Start a debounced pin in its current state, without a long press. */
+    if (intConfig.lockoutMs) {
+        bool isPressed = GPIOGetBit(pin) != intConfig.isActiveLow;
+        settings->pinStatus = isPressed ? RAISED : LOWERED;
+        GPIOLockedPins[config.pin / PINS_PER_PORT] &= ~pinAddress;
+        GPIOHeldPins[config.pin / PINS_PER_PORT] &= ~pinAddress;
+    }
 
     return pin;
 }
 
 /**
- * @brief Internal handler to manage GPIO interrupts.
+ * @brief GPIOGetTimestamp returns the time for an edge record. The timer
+ *        counts down, so its complement counts up.
  *
- * @param pin GPIOPin_t base to handle from.
+ * @return The timestamp, or 0 if no timer was started.
  */
-static void GPIOGeneric_Handler(GPIOPin_t pin) {
-    /* Initialization asserts. */
-    assert(pin < PIN_COUNT);
-
-    /** 1. Generate the port offset to find the correct addresses.
-     *    There are a couple components in this line:
-     *
-     *    Note (pin >= PIN_E0). This is a variation of a branchless programming
-     *    technique. See https://www.youtube.com/watch?v=bVJ-mWWL7cE for more
-     *    details.
-     *
-     *    (((pin - XXX) >> 3) << 12) :
-     *          Every group of eight pins belongs to the same port, and every
-     *          port has an offset of 0x1000 from each other (typically) (p.685
-     *          in the datasheet). This expression right shifts the pin to mask
-     *          the address (from 0 - 6 | A - F). It then left shifts it to get
-     *          the offset (1 << 12 is 0x1000). This is later appended to
-     *          GPIO_PORT_BASE to get the port address.
-     *
-     *          The term `- XXX` is a conditional expanded to the following:
-     *
-     *                        XXX = ((pin >= PIN_E0) << 5)
-     *
-     *          This conditional is similar to `(pin >= PIN_E0)`. If the pin is
-     *          in Port E or Port F, we subtract the effective pin by 32 (the
-     *          enum value of PIN_E0) to get the correct port offset. This is
-     *          equivalent to 1 << 5, where `(pin >= PIN_E0)` is 1 if true.
-     *
-     *    + (pin >= PIN_E0) << 17 :
-     *          Port E and F are special in that they requires an
-     *          extra offset of 0x0002.0000; we add that base offset, which is
-     *          equivalent to 1 << 7, where `(pin >= PIN_E0)` is 1 if true.
-     */
-    uint32_t portOffset =
-        (((pin - ((pin >= PIN_E0) << 5)) >> 3) << 12) + ((pin >= PIN_E0) << 17);
+static uint32_t GPIOGetTimestamp(void) {
+    if (!GPIOIsTimestamped) return 0;
+    return ~(uint32_t)TimerGetValue(GPIOTimestampTimer);
+}
 
-    /* 2. Find which pin triggered an interrupt. Could be multiple at once. */
-    uint8_t i;
-    for (i = 0; i < 8; i++) {
-        if (GET_REG(GPIO_PORT_BASE + portOffset + GPIO_MIS_OFFSET) & (0x1 << i)) {
-            /* Acknowledge interrupt flag. */
-            GET_REG(GPIO_PORT_BASE + portOffset + GPIO_ICR_OFFSET) |= 0x1 << i;
-
-            /* Get pin number. */
-            GPIOPin_t pinIdx = (GPIOPin_t)(pin + i);
-
-            if (!GPIOInterruptSettings[pinIdx].touchTask && !GPIOInterruptSettings[pinIdx].releaseTask) {
-                /* Both edge triggered. */
-                /* Get pin status. */
-                bool status = GPIOGetBit(pinIdx);
-                /* Figure out if rising or falling edge by reading the data register. */
-                if (status == 1 && GPIOInterruptSettings[pinIdx].pinStatus == LOWERED) {
-                    /* Rising edge. */
-                    GPIOInterruptSettings[pinIdx].touchTask(GPIOInterruptSettings[pinIdx].touchArgs);
-                    GPIOInterruptSettings[pinIdx].pinStatus = RAISED;
-                } else if (status == 0 && GPIOInterruptSettings[pinIdx].pinStatus == RAISED){
-                    /* Falling edge. */
-                    GPIOInterruptSettings[pinIdx].releaseTask(GPIOInterruptSettings[pinIdx].releaseArgs);
-                    GPIOInterruptSettings[pinIdx].pinStatus = LOWERED;
-                }
-            } else if (GPIOInterruptSettings[pinIdx].touchTask != NULL) {
-                /* Rising edge trigger. */
-                GPIOInterruptSettings[pinIdx].touchTask(GPIOInterruptSettings[pinIdx].touchArgs);
-                GPIOInterruptSettings[pinIdx].pinStatus = RAISED;
-            } else {
-                /* Falling edge trigger. */
-                GPIOInterruptSettings[pinIdx].releaseTask(GPIOInterruptSettings[pinIdx].releaseArgs);
-                GPIOInterruptSettings[pinIdx].pinStatus = LOWERED;
-            }
-        }
+/**
+ * @brief GPIOEventPush queues a record into the queue of its port, unless the
+ *        consumer has fallen behind.
+ *
+ * @param port GPIOPort_t of the pin.
+ * @param bit Bit of the pin in the port.
+ * @param timestamp Time of the record.
+ * @param isRising Whether the edge was rising, or the pin pressed.
+ * @param isLongPress Whether the record is a long press.
+ */
+static void GPIOEventPush(
+    GPIOPort_t port,
+    uint8_t bit,
+    uint32_t timestamp,
+    bool isRising,
+    bool isLongPress
+) {
+    struct GPIOEventQueue * queue = &GPIOEventQueues[port];
+    uint8_t head = queue->head;
+    if ((uint8_t)(head - queue->tail) >= GPIO_EVENT_QUEUE_DEPTH) {
+        queue->dropped++;
+        return;
     }
+
+    /* Fill the record, then publish it. */
+    volatile GPIOEvent_t * event = &queue->events[head & (GPIO_EVENT_QUEUE_DEPTH - 1)];
+    event->timestamp = timestamp;
+    event->pin = (GPIOPin_t)(port * PINS_PER_PORT + bit);
+    event->isRising = isRising;
+    event->isLongPress = isLongPress;
+    queue->head = head + 1;
 }
 
-void GPIOPortA_Handler(void) { GPIOGeneric_Handler(PIN_A0); }
+/**
+ * @brief GPIOEventRun runs the task of a pin for an edge or long press, if the
+ *        pin has one.
+ *
+ * @param settings Settings of the pin.
+ * @param isRising Whether the edge was rising, or the pin pressed.
+ * @param isLongPress Whether it is a long press.
+ */
+static void GPIOEventRun(
+    struct GPIOInterruptSettings * settings,
+    bool isRising,
+    bool isLongPress
+) {
+    if (isLongPress) {
+        if (settings->longPressTask) settings->longPressTask(settings->longPressArgs);
+    } else if (isRising) {
+        if (settings->touchTask) settings->touchTask(settings->touchArgs);
+    } else {
+        if (settings->releaseTask) settings->releaseTask(settings->releaseArgs);
+    }
+}
 
-void GPIOPortB_Handler(void) { GPIOGeneric_Handler(PIN_B0); }
+/**
+ * @brief GPIODebounceEdge handles an edge of a debounced pin. A change of the
+ *        debounced state is accepted and reported, and the pin is locked out:
+ *        its interrupt is masked until the debounce tick re-arms it.
+ *
+ * @param port GPIOPort_t of the pin.
+ * @param bit Bit of the pin in the port.
+ * @param isPressed Whether the pin was sampled pressed.
+ * @param timestamp Time of the edge.
+ */
+static void GPIODebounceEdge(GPIOPort_t port, uint8_t bit, bool isPressed, uint32_t timestamp) {
+    struct GPIOInterruptSettings * settings = &GPIOInterruptSettings[port][bit];
 
-void GPIOPortC_Handler(void) { GPIOGeneric_Handler(PIN_C0); }
+    /* 1. An edge that leaves the debounced state unchanged is a bounce. */
+    if (isPressed == (settings->pinStatus == RAISED)) {
+        ++GPIODebounceSuppressed;
+        return;
+    }
 
-void GPIOPortD_Handler(void) { GPIOGeneric_Handler(PIN_D0); }
+    /* 2. Mask the pin for the lockout window. A window ends on the tick after
+          lockoutTicks full ticks have passed. */
+    GET_REG(GPIOPortAddress(port) + GPIO_IM_OFFSET) &= ~(1 << bit);
+    settings->lockoutEnd = GPIODebounceTicks + settings->lockoutTicks + 1;
+    GPIOLockedPins[port] |= 1 << bit;
+
+    /* 3. Accept the new state, and time a long press from a press. */
+    settings->pinStatus = isPressed ? RAISED : LOWERED;
+    if (isPressed && settings->longPressTicks) {
+        settings->pressTick = GPIODebounceTicks;
+        GPIOHeldPins[port] |= 1 << bit;
+    } else {
+        GPIOHeldPins[port] &= ~(1 << bit);
+    }
 
-void GPIOPortE_Handler(void) { GPIOGeneric_Handler(PIN_E0); }
+    /* 4. Report the press or release. */
+    if (settings->isDeferred) {
+        GPIOEventPush(port, bit, timestamp, isPressed, false);
+    } else {
+        GPIOEventRun(settings, isPressed, false);
+    }
+}
 
-void GPIOPortF_Handler(void) { GPIOGeneric_Handler(PIN_F0); }
+/**
+ * @brief Internal handler to manage GPIO interrupts. Only the pending pins
+ *        are visited, highest first, found with count leading zeros.
+ *
+ * @param port GPIOPort_t to handle.
+ */
+static void GPIOGeneric_Handler(GPIOPort_t port) {
+    uint32_t portAddress = GPIOPortAddress(port);
+    struct GPIOInterruptSettings * portSettings = GPIOInterruptSettings[port];
+
+    /* 1. Read which pins triggered an interrupt once. Could be multiple at
+          once. */
+    uint32_t pins = GET_REG(portAddress + GPIO_MIS_OFFSET) & 0xFF;
+
+    /* 2. Acknowledge every pending pin in one write. ICR is write one to
+          clear, so pins that trigger from now on are kept. */
+    GET_REG(portAddress + GPIO_ICR_OFFSET) = pins;
+
+    if (GPIOInterruptHook != NULL) GPIOInterruptHook(port, pins, false);
+
+    /* 3. Stamp the interrupt for deferred and debounced pins. */
+    uint32_t timestamp = GPIOGetTimestamp();
+
+    /* 4. Dispatch or queue each pending pin. */
+    uint32_t pending = pins;
+    while (pending) {
+        uint8_t bit = 31 - GPIO_CLZ(pending);
+        pending &= ~(1 << bit);
+        struct GPIOInterruptSettings * settings = &portSettings[bit];
+
+        if (settings->lockoutTicks) {
+            bool isPressed = GPIOGetBit((GPIOPin_t)(port * PINS_PER_PORT + bit)) != settings->isActiveLow;
+            GPIODebounceEdge(port, bit, isPressed, timestamp);
+            continue;
+        }
 
-#ifdef __FAST__
-void GPIOSetBit(GPIOPin_t pin, bool val) {
-    /* Initialization asserts. */
-    assert(pin < PIN_COUNT);
+        /* Determine the edge. */
+        bool isRising;
+        if (!settings->touchTask && !settings->releaseTask) {
+            /* Both edge triggered. */
+            /* Get pin status. */
+            bool status = GPIOGetBit((GPIOPin_t)(port * PINS_PER_PORT + bit));
+            /* Figure out if rising or falling edge by reading the data
+               register. Ignore it if the status has not changed. */
+            if (status == (settings->pinStatus == RAISED)) continue;
+            isRising = status;
+        } else {
+            /* Rising edge trigger if touchTask, else falling edge trigger. */
+            isRising = settings->touchTask != NULL;
+        }
+        settings->pinStatus = isRising ? RAISED : LOWERED;
 
-    switch (pin) {
-        case PIN_A0:
-            GET_REG(0x40004004) = val;
-            break;
-        case PIN_A1:
-            GET_REG(0x40004008) = val << 1;
-            break;
-        case PIN_A2:
-            GET_REG(0x40004010) = val << 2;
-            break;
-        case PIN_A3:
-            GET_REG(0x40004020) = val << 3;
-            break;
-        case PIN_A4:
-            GET_REG(0x40004040) = val << 4;
-            break;
-        case PIN_A5:
-            GET_REG(0x40004080) = val << 5;
-            break;
-        case PIN_A6:
-            GET_REG(0x40004100) = val << 6;
-            break;
-        case PIN_A7:
-            GET_REG(0x40004200) = val << 7;
-            break;
+        if (settings->isDeferred) {
+            GPIOEventPush(port, bit, timestamp, isRising, false);
+        } else if (isRising) {
+            settings->touchTask(settings->touchArgs);
+        } else {
+            settings->releaseTask(settings->releaseArgs);
+        }
+    }
 
-        case PIN_B0:
-            GET_REG(0x40005004) = val;
-            break;
-        case PIN_B1:
-            GET_REG(0x40005008) = val << 1;
-            break;
-        case PIN_B2:
-            GET_REG(0x40005010) = val << 2;
-            break;
-        case PIN_B3:
-            GET_REG(0x40005020) = val << 3;
-            break;
-        case PIN_B4:
-            GET_REG(0x40005040) = val << 4;
-            break;
-        case PIN_B5:
-            GET_REG(0x40005080) = val << 5;
-            break;
-        case PIN_B6:
-            GET_REG(0x40005100) = val << 6;
-            break;
-        case PIN_B7:
-            GET_REG(0x40005200) = val << 7;
-            break;
+    if (GPIOInterruptHook != NULL) GPIOInterruptHook(port, pins, true);
+}
 
-        case PIN_C0:
-            GET_REG(0x40006004) = val;
-            break;
-        case PIN_C1:
-            GET_REG(0x40006008) = val << 1;
-            break;
-        case PIN_C2:
-            GET_REG(0x40006010) = val << 2;
-            break;
-        case PIN_C3:
-            GET_REG(0x40006020) = val << 3;
-            break;
-        case PIN_C4:
-            GET_REG(0x40006040) = val << 4;
-            break;
-        case PIN_C5:
-            GET_REG(0x40006080) = val << 5;
-            break;
-        case PIN_C6:
-            GET_REG(0x40006100) = val << 6;
-            break;
-        case PIN_C7:
-            GET_REG(0x40006200) = val << 7;
-            break;
+void GPIOTimestampInit(TimerID_t timer) {
+    /* Initialization asserts. */
+    assert(WTIMER_0A <= timer && timer <= WTIMER_5A);
+    assert((timer % 2) == 0);
+
+    /* 1. Count down from the largest period. The concatenated 64 bit timer
+          wraps its lower 32 bits every 2^32 cycles. */
+    TimerConfig_t timerConfig = {
+        .timerID=timer,
+        .period=0xFFFFFFFFFFFFFFFF,
+        .isPeriodic=true
+    };
+    GPIOTimestampTimer = TimerInit(timerConfig);
+
+    /* 2. Stamp records from now on. */
+    GPIOIsTimestamped = true;
+}
 
-        case PIN_D0:
-            GET_REG(0x40007004) = val;
-            break;
-        case PIN_D1:
-            GET_REG(0x40007008) = val << 1;
-            break;
-        case PIN_D2:
-            GET_REG(0x40007010) = val << 2;
-            break;
-        case PIN_D3:
-            GET_REG(0x40007020) = val << 3;
-            break;
-        case PIN_D4:
-            GET_REG(0x40007040) = val << 4;
-            break;
-        case PIN_D5:
-            GET_REG(0x40007080) = val << 5;
-            break;
-        case PIN_D6:
-            GET_REG(0x40007100) = val << 6;
-            break;
-        case PIN_D7:
-            GET_REG(0x40007200) = val << 7;
-            break;
+/**
+ * @brief GPIODebounceTick is the shared debounce tick task. It re-arms the
+ *        locked out pins whose window has passed and reports long presses.
+ *        Only the locked and held pins are visited.
+ *
+ * @param args Unused.
+ */
+static void GPIODebounceTick(uint32_t * args) {
+    uint32_t ticks = ++GPIODebounceTicks;
+    uint8_t port;
+    for (port = 0; port < PORT_COUNT; ++port) {
+        uint32_t portAddress = GPIOPortAddress((GPIOPort_t)port);
+
+        /* 1. Re-arm each locked pin whose window has passed. */
+        uint32_t locked = GPIOLockedPins[port];
+        while (locked) {
+            uint8_t bit = 31 - GPIO_CLZ(locked);
+            locked &= ~(1 << bit);
+            struct GPIOInterruptSettings * settings = &GPIOInterruptSettings[port][bit];
+            if ((int32_t)(ticks - settings->lockoutEnd) < 0) continue;
+
+            /* Edges latched while masked are discarded before unmasking. If
+               the pin settled back in its debounced state, they were bounces. */
+            bool isPressed = GPIOGetBit((GPIOPin_t)(port * PINS_PER_PORT + bit)) != settings->isActiveLow;
+            bool isChanged = isPressed != (settings->pinStatus == RAISED);
+            if (!isChanged && (GET_REG(portAddress + GPIO_RIS_OFFSET) & (1 << bit))) {
+                ++GPIODebounceSuppressed;
+            }
+            GET_REG(portAddress + GPIO_ICR_OFFSET) = 1 << bit;
+            GPIOLockedPins[port] &= ~(1 << bit);
 
-        case PIN_E0:
-            GET_REG(0x40024004) = val;
-            break;
-        case PIN_E1:
-            GET_REG(0x40024008) = val << 1;
-            break;
-        case PIN_E2:
-            GET_REG(0x40024010) = val << 2;
-            break;
-        case PIN_E3:
-            GET_REG(0x40024020) = val << 3;
-            break;
-        case PIN_E4:
-            GET_REG(0x40024040) = val << 4;
-            break;
-        case PIN_E5:
-            GET_REG(0x40024080) = val << 5;
-            break;
-        case PIN_E6:
-            GET_REG(0x40024100) = val << 6;
-            break;
-        case PIN_E7:
-            GET_REG(0x40024200) = val << 7;
-            break;
+            /* If the pin settled in the other state during the window, accept
+               the change now, which locks the pin out again. */
+            if (isChanged) {
+                GPIODebounceEdge((GPIOPort_t)port, bit, isPressed, GPIOGetTimestamp());
+            } else {
+                GET_REG(portAddress + GPIO_IM_OFFSET) |= 1 << bit;
+            }
+        }
 
-        case PIN_F0:
-            GET_REG(0x40025004) = val;
-            break;
-        case PIN_F1:
-            GET_REG(0x40025008) = val << 1;
-            break;
-        case PIN_F2:
-            GET_REG(0x40025010) = val << 2;
-            break;
-        case PIN_F3:
-            GET_REG(0x40025020) = val << 3;
-            break;
-        case PIN_F4:
-            GET_REG(0x40025040) = val << 4;
-            break;
-        case PIN_F5:
-            GET_REG(0x40025080) = val << 5;
-            break;
-        case PIN_F6:
-            GET_REG(0x40025100) = val << 6;
-            break;
-        case PIN_F7:
-            GET_REG(0x40025200) = val << 7;
-            break;
-        default:
-            assert(0); // Failure condition - this passed the initial assert.
+        /* 2. Report each pin held for its long press time, once per press. */
+        uint32_t held = GPIOHeldPins[port];
+        while (held) {
+            uint8_t bit = 31 - GPIO_CLZ(held);
+            held &= ~(1 << bit);
+            struct GPIOInterruptSettings * settings = &GPIOInterruptSettings[port][bit];
+            if (ticks - settings->pressTick < settings->longPressTicks) continue;
+
+            GPIOHeldPins[port] &= ~(1 << bit);
+            if (settings->isDeferred) {
+                GPIOEventPush((GPIOPort_t)port, bit, GPIOGetTimestamp(), true, true);
+            } else {
+                GPIOEventRun(settings, true, true);
+            }
+        }
     }
 }
 
-bool GPIOGetBit(GPIOPin_t pin) {
+void GPIODebounceInit(GPIODebounceConfig_t config) {
     /* Initialization asserts. */
-    assert(pin < PIN_COUNT);
-
-    switch (pin) {
-        case PIN_A0:
-            return GET_REG(0x40004004);
-        case PIN_A1:
-            return GET_REG(0x40004008);
-        case PIN_A2:
-            return GET_REG(0x40004010);
-        case PIN_A3:
-            return GET_REG(0x40004020);
-        case PIN_A4:
-            return GET_REG(0x40004040);
-        case PIN_A5:
-            return GET_REG(0x40004080);
-        case PIN_A6:
-            return GET_REG(0x40004100);
-        case PIN_A7:
-            return GET_REG(0x40004200);
-
-        case PIN_B0:
-            return GET_REG(0x40005004);
-        case PIN_B1:
-            return GET_REG(0x40005008);
-        case PIN_B2:
-            return GET_REG(0x40005010);
-        case PIN_B3:
-            return GET_REG(0x40005020);
-        case PIN_B4:
-            return GET_REG(0x40005040);
-        case PIN_B5:
-            return GET_REG(0x40005080);
-        case PIN_B6:
-            return GET_REG(0x40005100);
-        case PIN_B7:
-            return GET_REG(0x40005200);
-
-        case PIN_C0:
-            return GET_REG(0x40006004);
-        case PIN_C1:
-            return GET_REG(0x40006008);
-        case PIN_C2:
-            return GET_REG(0x40006010);
-        case PIN_C3:
-            return GET_REG(0x40006020);
-        case PIN_C4:
-            return GET_REG(0x40006040);
-        case PIN_C5:
-            return GET_REG(0x40006080);
-        case PIN_C6:
-            return GET_REG(0x40006100);
-        case PIN_C7:
-            return GET_REG(0x40006200);
-
-        case PIN_D0:
-            return GET_REG(0x40007004);
-        case PIN_D1:
-            return GET_REG(0x40007008);
-        case PIN_D2:
-            return GET_REG(0x40007010);
-        case PIN_D3:
-            return GET_REG(0x40007020);
-        case PIN_D4:
-            return GET_REG(0x40007040);
-        case PIN_D5:
-            return GET_REG(0x40007080);
-        case PIN_D6:
-            return GET_REG(0x40007100);
-        case PIN_D7:
-            return GET_REG(0x40007200);
-
-        case PIN_E0:
-            return GET_REG(0x40024004);
-        case PIN_E1:
-            return GET_REG(0x40024008);
-        case PIN_E2:
-            return GET_REG(0x40024010);
-        case PIN_E3:
-            return GET_REG(0x40024020);
-        case PIN_E4:
-            return GET_REG(0x40024040);
-        case PIN_E5:
-            return GET_REG(0x40024080);
-        case PIN_E6:
-            return GET_REG(0x40024100);
-        case PIN_E7:
-            return GET_REG(0x40024200);
-
-        case PIN_F0:
-            return GET_REG(0x40025004);
-        case PIN_F1:
-            return GET_REG(0x40025008);
-        case PIN_F2:
-            return GET_REG(0x40025010);
-        case PIN_F3:
-            return GET_REG(0x40025020);
-        case PIN_F4:
-            return GET_REG(0x40025040);
-        case PIN_F5:
-            return GET_REG(0x40025080);
-        case PIN_F6:
-            return GET_REG(0x40025100);
-        case PIN_F7:
-            return GET_REG(0x40025200);
-        default:
-            assert(0); // Failure condition - this passed the initial assert.
-            return false;
-    }
+    assert(config.timer < SYSTICK);
+    assert(config.priority <= 7);
+    assert(!GPIOIsDebounced);
+
+    /* 1. Start the shared tick. */
+    TimerConfig_t timerConfig = {
+        .timerID=config.timer,
+        .period=freqToPeriod(GPIO_DEBOUNCE_TICK_FREQUENCY, MAX_FREQ),
+        .timerTask=GPIODebounceTick,
+        .isPeriodic=true,
+        .priority=config.priority
+    };
+    TimerInit(timerConfig);
+
+    /* 2. Allow debounced pins at the same priority. */
+    GPIODebouncePriority = config.priority;
+    GPIOIsDebounced = true;
 }
 
-#else
+uint32_t GPIODebounceGetSuppressedCount(void) {
+    return GPIODebounceSuppressed;
+}
 
-void GPIOSetBit(GPIOPin_t pin, bool value) {
+bool GPIOEventTryRead(GPIOEvent_t * event) {
     /* Initialization asserts. */
-    assert(pin < PIN_COUNT);
+    assert(event != NULL);
+
+    /* 1. Find the port whose oldest record is the oldest. Timestamps are
+          compared by their wrapping difference. */
+    struct GPIOEventQueue * oldest = NULL;
+    uint32_t oldestTimestamp = 0;
+    uint8_t port;
+    for (port = 0; port < PORT_COUNT; ++port) {
+        struct GPIOEventQueue * queue = &GPIOEventQueues[port];
+        uint8_t tail = queue->tail;
+        if (tail == queue->head) continue;
+
+        uint32_t timestamp = queue->events[tail & (GPIO_EVENT_QUEUE_DEPTH - 1)].timestamp;
+        if (oldest == NULL || (int32_t)(timestamp - oldestTimestamp) < 0) {
+            oldest = queue;
+            oldestTimestamp = timestamp;
+        }
+    }
+    if (oldest == NULL) return false;
+
+    /* 2. Copy the record out. */
+    uint8_t tail = oldest->tail;
+    volatile GPIOEvent_t * record = &oldest->events[tail & (GPIO_EVENT_QUEUE_DEPTH - 1)];
+    event->timestamp = record->timestamp;
+    event->pin = record->pin;
+    event->isRising = record->isRising;
+    event->isLongPress = record->isLongPress;
+
+    /* 3. Release the record back to the handler only after it is copied. */
+    oldest->tail = tail + 1;
+    return true;
+}
 
-    /* 1. Generate the port offset to find the correct addresses.
-          There are a couple components in this line:
+uint32_t GPIOEventDispatch(void) {
+    uint32_t count = 0;
+    GPIOEvent_t event;
+    while (GPIOEventTryRead(&event)) {
+        GPIOEventRun(
+            &GPIOInterruptSettings[event.pin / PINS_PER_PORT][event.pin % PINS_PER_PORT],
+            event.isRising,
+            event.isLongPress
+        );
+        ++count;
+    }
+    return count;
+}
 
-          Note (pin >= PIN_E0). This is a variation of a branchless programming
-          technique. See https://www.youtube.com/watch?v=bVJ-mWWL7cE for more
-          details.
+uint32_t GPIOEventGetDroppedCount(void) {
+    uint32_t dropped = 0;
+    uint8_t port;
+    for (port = 0; port < PORT_COUNT; ++port) {
+        dropped += GPIOEventQueues[port].dropped;
+    }
+    return dropped;
+}
 
-         (((pin - XXX) >> 3) << 12) :
-                Every group of eight pins belongs to the same port, and every
-                port has an offset of 0x1000 from each other (typically) (p.685
-                in the datasheet). This expression right shifts the pin to mask
-                the address (from 0 - 6 | A - F). It then left shifts it to get
-                the offset (1 << 12 is 0x1000). This is later appended to
-                GPIO_PORT_BASE to get the port address.
+void GPIOSetInterruptHook(void (*hook)(GPIOPort_t port, uint8_t pins, bool isExit)) {
+    GPIOInterruptHook = hook;
+}
 
-                The term `- XXX` is a conditional expanded to the following:
+void GPIOPortA_Handler(void) { GPIOGeneric_Handler(PORT_A); }
 
-                              XXX = ((pin >= PIN_E0) << 5)
+void GPIOPortB_Handler(void) { GPIOGeneric_Handler(PORT_B); }
 
-                This conditional is similar to `(pin >= PIN_E0)`. If the pin is
-                in Port E or Port F, we subtract the effective pin by 32 (the
-                enum value of PIN_E0) to get the correct port offset. This is
-                equivalent to 1 << 5, where `(pin >= PIN_E0)` is 1 if true.
+void GPIOPortC_Handler(void) { GPIOGeneric_Handler(PORT_C); }
 
-          + (pin >= PIN_E0) << 17 :
-                Port E and F are special in that they requires an
-                extra offset of 0x0002.0000; we add that base offset, which is
-                equivalent to 1 << 7, where `(pin >= PIN_E0)` is 1 if true. */
-    uint32_t portOffset =
-        (((pin - ((pin >= PIN_E0) << 5)) >> 3) << 12) + ((pin >= PIN_E0) << 17);
+void GPIOPortD_Handler(void) { GPIOGeneric_Handler(PORT_D); }
 
-    /* 2. Determine the pin address. I.E. PF1 (41) % 8 = 1. */
-    pin &= 0x07;
-    GET_REG(GPIO_PORT_BASE + portOffset + (1 << (pin + 2))) = value << pin;
+void GPIOPortE_Handler(void) { GPIOGeneric_Handler(PORT_E); }
+
+void GPIOPortF_Handler(void) { GPIOGeneric_Handler(PORT_F); }
+
+void GPIOPortWrite(GPIOPort_t port, uint8_t mask, uint8_t value) {
+    /* Initialization asserts. */
+    assert(port <= PORT_F);
+
+    GET_REG(GPIOPortAddress(port) + (mask << 2)) = value;
 }
 
-bool GPIOGetBit(GPIOPin_t pin) {
+uint8_t GPIOPortRead(GPIOPort_t port, uint8_t mask) {
     /* Initialization asserts. */
-    assert(pin < PIN_COUNT);
-
-    /** 1. Generate the port offset to find the correct addresses.
-     *    There are a couple components in this line:
-     *
-     *    Note (pin >= PIN_E0). This is a variation of a branchless programming
-     *    technique. See https://www.youtube.com/watch?v=bVJ-mWWL7cE for more
-     *    details.
-     *
-     *    (((pin - XXX >> 3) << 12) :
-     *          Every group of eight pins belongs to the same port, and every
-     *          port has an offset of 0x1000 from each other (typically) (p.685
-     *          in the datasheet). This expression right shifts the pin to mask
-     *          the address (from 0 - 6 | A - F). It then left shifts it to get
-     *          the offset (1 << 12 is 0x1000). This is later appended to
-     *          GPIO_PORT_BASE to get the port address.
-     *
-     *          The term `- XXX` is a conditional expanded to the following:
-     *
-     *                        XXX = ((pin >= PIN_E0) << 5)
-     *
-     *          This conditional is similar to `(pin >= PIN_E0)`. If the pin is
-     *          in Port E or Port F, we subtract the effective pin by 32 (the
-     *          enum value of PIN_E0) to get the correct port offset. This is
-     *          equivalent to 1 << 5, where `(pin >= PIN_E0)` is 1 if true.
-     *
-     *    + (pin >= PIN_E0) << 17 :
-     *          Port E and F are special in that they requires an
-     *          extra offset of 0x0002.0000; we add that base offset, which is
-     *          equivalent to 1 << 7, where `(pin >= PIN_E0)` is 1 if true.
-     */
-    uint32_t portOffset =
-        (((pin - ((pin >= PIN_E0) << 5)) >> 3) << 12) + ((pin >= PIN_E0) << 17);
+    assert(port <= PORT_F);
 
-    /* 2. Determine the pin address. I.E. PF1 (41) % 8 = 1. */
-    return GET_REG(GPIO_PORT_BASE + portOffset + (1 << ((pin & 0x07) + 2)));
+    return GET_REG(GPIOPortAddress(port) + (mask << 2));
+}
+
+GPIOPinGroup_t GPIOPinGroupInit(GPIOPin_t * pins, uint8_t numPins) {
+    /* Initialization asserts. */
+    assert(pins != NULL);
+    assert(1 <= numPins && numPins <= PINS_PER_PORT);
+
+    GPIOPort_t port = (GPIOPort_t)(pins[0] / PINS_PER_PORT);
+    uint8_t mask = 0;
+    uint8_t i;
+    for (i = 0; i < numPins; ++i) {
+        assert(pins[i] < PIN_COUNT);
+        assert(pins[i] / PINS_PER_PORT == port);
+        mask |= 1 << (pins[i] % PINS_PER_PORT);
+    }
+
+    GPIOPinGroup_t group = {
+        .address=GPIOPortAddress(port) + (mask << 2),
+        .mask=mask
+    };
+
+    return group;
+}
+
+void GPIOPinGroupWrite(GPIOPinGroup_t group, uint8_t value) {
+    GET_REG(group.address) = value;
+}
+
+uint8_t GPIOPinGroupRead(GPIOPinGroup_t group) {
+    return GET_REG(group.address);
 }
-#endif
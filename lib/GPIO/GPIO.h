@@ -6,13 +6,36 @@
  * @date 2021-09-28
  * @copyright Copyright (c) 2021
  * @note
- * Fast Mode. Use optional compilation flag (1) or define a preprocessor macro
- * (2) in your project for compiling with GPIOSetBit(Fast) and GPIOGetBit(Fast).
- *      (1) `-D__FAST__`
- *      (2) `#define __FAST__ 1`
- * This is high recommended for programs using interrupts that call these
- * functions to edit GPIO bits, or for high frequency operation programs. There
- * is a tradeoff of on the order of 100x speedup vs 1KB more lines of DATA.
+ * Inline Access. GPIOSetBit and GPIOGetBit are defined inline in GPIO.h and
+ * access a pin through the DATA register alias masked to it, computed from the
+ * pin with shifts and adds only. For a pin known at compile time, the address
+ * folds into a constant and each call reduces to a single store or load.
+ *
+ * Port Access. GPIOPortWrite and GPIOPortRead access any subset of the pins of
+ * a port at once, through the address masked aliases of the DATA register:
+ * bits 9:2 of the address select the pins a store changes or a load returns.
+ * A multi-pin update is then a single store, so the pins change together. A
+ * GPIOPinGroup_t precomputes the alias of a fixed set of pins.
+ *
+ * Deferred Events. A pin initialized with isDeferred does not run its task in
+ * the port handler. The handler pushes a (pin, edge, timestamp) record into a
+ * single producer, single consumer queue of its port instead, and returns in
+ * constant time. The main loop, or a low priority task, pops the records with
+ * GPIOEventTryRead or runs their tasks with GPIOEventDispatch. Records are
+ * stamped from the free running timer started by GPIOTimestampInit. If a
+ * queue is full, the record is dropped and counted (GPIOEventGetDroppedCount).
+ *
+ * Debouncing. A pin initialized with a lockoutMs interrupts on both edges. An
+ * edge that changes the debounced state of the pin is accepted and reported
+ * as a press (touchTask) or release (releaseTask), and the interrupt of the
+ * pin is masked for lockoutMs, so its bounces do not interrupt at all. A
+ * single shared 1 ms tick, started by GPIODebounceInit, re-arms every pin
+ * whose window has passed. If the pin settled in the other state during the
+ * window, the change is accepted then. The tick also reports a long press
+ * (longPressTask) once a pin is held for longPressMs. Only pins locked out or
+ * held are visited on a tick, so one timer serves every pin. Edges that do not
+ * change the debounced state, and windows in which the pin bounced, are
+ * counted (GPIODebounceGetSuppressedCount).
  *
  * Unsupported Features. This driver does not support DMA control.
  */
@@ -22,6 +45,21 @@
 /** General imports. */
 #include <stdbool.h>
 #include <stdint.h>
+#include <assert.h>
+
+/** Device specific imports. */
+#include <inc/Inline.h>
+#include <inc/RegDefs.h>
+#include <lib/Timer/Timer.h>
+
+
+/** @brief Number of edge records each port queue holds. Must be a power of
+ *         two. */
+#define GPIO_EVENT_QUEUE_DEPTH 16
+
+/** @brief Frequency of the debounce tick, in hz. Lockout and long press times
+ *         are counted in its 1 ms ticks. */
+#define GPIO_DEBOUNCE_TICK_FREQUENCY 1000
 
 
 /** @brief GPIOPin_t is an enumeration that specifies a GPIO pin on the TM4C. */
@@ -35,6 +73,11 @@ typedef enum GPIOPin {
     PIN_COUNT, PINS_PER_PORT = 8, PORT_COUNT = PIN_COUNT / PINS_PER_PORT,
 } GPIOPin_t;
 
+/** @brief GPIOPort_t is an enumeration that specifies a GPIO port on the TM4C. */
+typedef enum GPIOPort {
+    PORT_A, PORT_B, PORT_C, PORT_D, PORT_E, PORT_F,
+} GPIOPort_t;
+
 /**
  * @brief GPIOConfig_t is a user defined struct that specifies a GPIO pin
  *        configuration.
@@ -158,8 +201,116 @@ typedef struct GPIOInterruptConfig {
      * Default is LOWERED.
      */
     enum GPIOIntPinStatus {LOWERED, RAISED} pinStatus;
+
+    /**
+     * @brief Whether touchTask and releaseTask are deferred out of the
+     *        interrupt. The port handler queues a record of each edge, and the
+     *        task runs when GPIOEventDispatch is called.
+     *
+     * Default is false (Tasks run in the interrupt).
+     */
+    bool isDeferred;
+
+    /**
+     * @brief Lockout window after each accepted edge, in ms. When nonzero, the
+     *        pin is debounced: touchTask is called on a press and releaseTask
+     *        on a release, and either may be NULL. Requires GPIODebounceInit
+     *        to be called first, with the same priority.
+     *
+     * Default is 0 (Not debounced).
+     */
+    uint16_t lockoutMs;
+
+    /**
+     * @brief Whether a debounced pin is pressed when low, such as a switch to
+     *        ground with a pull up.
+     *
+     * Default is false (Pressed when high).
+     */
+    bool isActiveLow;
+
+    /**
+     * @brief Time a debounced pin is held before longPressTask is called, in
+     *        ms. Called once per press.
+     *
+     * Default is 0 (No long press).
+     */
+    uint16_t longPressMs;
+
+    /**
+     * @brief Pointer to function called on a long press of a debounced pin.
+     *
+     * Default is NULL (No function defined).
+     */
+    void (*longPressTask)(uint32_t *args);
+
+    /**
+     * @brief The pointer to an array of uint32_t arguments that fed into
+     *        longPressTask upon being called.
+     *
+     * Default is NULL (No pointer to any arguments is defined).
+     */
+    uint32_t * longPressArgs;
 } GPIOInterruptConfig_t;
 
+/** @brief GPIODebounceConfig_t is a user defined struct that specifies the
+ *         shared debounce tick. */
+typedef struct GPIODebounceConfig {
+    /**
+     * @brief The timer running the debounce tick.
+     *
+     * Default is TIMER_0A.
+     */
+    TimerID_t timer;
+
+    /** ------------- Optional Fields. ------------- */
+
+    /**
+     * @brief Interrupt priority of the tick. From 0 - 7. Lower value is higher
+     *        priority. The NVIC priority is per port, so every interrupt
+     *        pin on a port with debounced pins must use the same priority.
+     *        The tick and the port handlers then do not preempt each other.
+     *
+     * Default is 0 (Highest priority).
+     */
+    uint8_t priority;
+} GPIODebounceConfig_t;
+
+/** @brief GPIOEvent_t is a record of an edge on a deferred pin. */
+typedef struct GPIOEvent {
+    /**
+     * @brief The time of the port interrupt, in clock cycles of the timer
+     *        started by GPIOTimestampInit. Wraps every 2^32 cycles, so
+     *        differences of up to 2^32 - 1 cycles are exact. 0 if no timer
+     *        was started.
+     */
+    uint32_t timestamp;
+
+    /** @brief The pin of the edge. */
+    GPIOPin_t pin;
+
+    /** @brief Whether the edge was rising (touchTask) or falling
+     *         (releaseTask). For a debounced pin, whether it was a press or a
+     *         release. */
+    bool isRising;
+
+    /** @brief Whether the record is a long press of a debounced pin
+     *         (longPressTask). isRising is then true. */
+    bool isLongPress;
+} GPIOEvent_t;
+
+/**
+ * @brief GPIOPinGroup_t is a set of pins on the same port, written and read
+ *        together with a single access.
+ */
+typedef struct GPIOPinGroup {
+    /** @brief Address of the DATA register alias masked to the pins. */
+    uint32_t address;
+
+    /** @brief The pins of the group, as bits of the port. */
+    uint8_t mask;
+} GPIOPinGroup_t;
+
 /**
  * @brief GPIOInit initializes a GPIO pin given a configuration.
  *
@@ -180,6 +331,94 @@ GPIOPin_t GPIOInit(GPIOConfig_t config);
  */
 GPIOPin_t GPIOIntInit(GPIOConfig_t config, GPIOInterruptConfig_t intConfig);
 
+/**
+ * @brief GPIOTimestampInit starts a free running timer and stamps every edge
+ *        record queued from then on with it.
+ *
+ * @param timer The wide timer to use, concatenated, from WTIMER_0A -
+ *        WTIMER_5A. Must be an A side timer. Its B side is used as well.
+ */
+void GPIOTimestampInit(TimerID_t timer);
+
+/**
+ * @brief GPIODebounceInit starts the shared tick that re-arms debounced pins
+ *        and reports long presses.
+ *
+ * @param config The configuration of the tick.
+ * @note Must be called before initializing a debounced pin.
+ */
+void GPIODebounceInit(GPIODebounceConfig_t config);
+
+/**
+ * @brief GPIODebounceGetSuppressedCount returns the number of bounces
+ *        suppressed on debounced pins: edges that did not change the
+ *        debounced state, and lockout windows in which the pin bounced.
+ *
+ * @return The number of suppressed bounces.
+ */
+uint32_t GPIODebounceGetSuppressedCount(void);
+
+/**
+ * @brief GPIOEventTryRead pops the oldest edge record of every deferred pin,
+ *        across all ports, if any. Does not block and does not disable
+ *        interrupts.
+ *
+ * @param event A reference to fill with the record.
+ * @return Whether a record was popped.
+ */
+bool GPIOEventTryRead(GPIOEvent_t * event);
+
+/**
+ * @brief GPIOEventDispatch pops every queued edge record, oldest first, and
+ *        runs the touchTask, releaseTask or longPressTask of its pin.
+ *
+ * @return The number of records dispatched.
+ * @note Call from the main loop or a low priority task.
+ */
+uint32_t GPIOEventDispatch(void);
+
+/**
+ * @brief GPIOEventGetDroppedCount returns the number of edge records dropped
+ *        because the queue of their port was full.
+ *
+ * @return The number of dropped records.
+ */
+uint32_t GPIOEventGetDroppedCount(void);
+
+/**
+ * @brief GPIOSetInterruptHook sets a function called on entry to and exit from
+ *        every GPIO port handler, such as one that reads a timer or toggles a
+ *        pin, to measure the handler latency and duration.
+ *
+ * @param hook The function, called with the port, the pins being handled as
+ *        bits of the port, and whether the handler is exiting. NULL to
+ *        remove it.
+ */
+void GPIOSetInterruptHook(void (*hook)(GPIOPort_t port, uint8_t pins, bool isExit));
+
+/**
+ * @brief GPIOPortAddress returns the base address of a port. Ports A - D are
+ *        0x1000 apart from GPIO_PORT_BASE, and ports E and F are another
+ *        0x0001.C000 further.
+ *
+ * @param port GPIOPort_t to locate.
+ * @return The base address of the port.
+ */
+STATIC_INLINE uint32_t GPIOPortAddress(GPIOPort_t port) {
+    return GPIO_PORT_BASE + (port << 12) + ((port >= PORT_E) * 0x1C000);
+}
+
+/**
+ * @brief GPIOPinAddress returns the address of the DATA register alias masked
+ *        to a pin: bits 9:2 of the port address select the pin.
+ *
+ * @param pin GPIOPin_t to locate.
+ * @return The address of the alias.
+ */
+STATIC_INLINE uint32_t GPIOPinAddress(GPIOPin_t pin) {
+    return GPIOPortAddress((GPIOPort_t)(pin >> 3)) + (4 << (pin & 7));
+}
+
 /**
  * @brief GPIOSetBit sets the bit for an (assumed) output GPIO pin.
  *
@@ -187,7 +426,13 @@ GPIOPin_t GPIOIntInit(GPIOConfig_t config, GPIOInterruptConfig_t intConfig);
  * @param value 0 (false) or 1 (true) value to set pin to.
  * @note This method assumes that the GPIO was configured as an output.
  */
-void GPIOSetBit(GPIOPin_t pin, bool value);
+STATIC_INLINE void GPIOSetBit(GPIOPin_t pin, bool value) {
+    /* Initialization asserts. */
+    assert(pin < PIN_COUNT);
+
+    /* The alias masks out the other pins, so the store can set all bits. */
+    GET_REG(GPIOPinAddress(pin)) = value ? 0xFF : 0x00;
+}
 
 /**
  * @brief GPIOGetBit returns the value of the bit at the specified GPIO pin.
@@ -195,4 +440,58 @@ void GPIOSetBit(GPIOPin_t pin, bool value);
  * @param pin GPIOPin_t to set.
  * @return value 0 (false) or 1 (true) value of the pin.
  */
-bool GPIOGetBit(GPIOPin_t pin);
+STATIC_INLINE bool GPIOGetBit(GPIOPin_t pin) {
+    /* Initialization asserts. */
+    assert(pin < PIN_COUNT);
+
+    return GET_REG(GPIOPinAddress(pin)) != 0;
+}
+
+/**
+ * @brief GPIOPortWrite sets the masked pins of a port in a single store. The
+ *        other pins of the port are unchanged.
+ *
+ * @param port GPIOPort_t to write.
+ * @param mask The pins to change, as bits of the port.
+ * @param value The values of the pins, as bits of the port. Bits outside of
+ *        mask are ignored.
+ * @note This method assumes that the pins were configured as outputs.
+ */
+void GPIOPortWrite(GPIOPort_t port, uint8_t mask, uint8_t value);
+
+/**
+ * @brief GPIOPortRead returns the masked pins of a port in a single load.
+ *
+ * @param port GPIOPort_t to read.
+ * @param mask The pins to read, as bits of the port.
+ * @return The values of the pins, as bits of the port. Bits outside of mask
+ *         are 0.
+ */
+uint8_t GPIOPortRead(GPIOPort_t port, uint8_t mask);
+
+/**
+ * @brief GPIOPinGroupInit precomputes the masked DATA alias of a set of pins
+ *        on the same port. The pins must already be initialized.
+ *
+ * @param pins An array of numPins pins, all on the same port.
+ * @param numPins The number of pins in the group, from 1 - 8.
+ * @return A GPIOPinGroup_t for GPIOPinGroupWrite and GPIOPinGroupRead.
+ */
+GPIOPinGroup_t GPIOPinGroupInit(GPIOPin_t * pins, uint8_t numPins);
+
+/**
+ * @brief GPIOPinGroupWrite sets the pins of a group in a single store.
+ *
+ * @param group The group to write.
+ * @param value The values of the pins, as bits of the port.
+ */
+void GPIOPinGroupWrite(GPIOPinGroup_t group, uint8_t value);
+
+/**
+ * @brief GPIOPinGroupRead returns the pins of a group in a single load.
+ *
+ * @param group The group to read.
+ * @return The values of the pins, as bits of the port. Bits of other pins
+ *         are 0.
+ */
+uint8_t GPIOPinGroupRead(GPIOPinGroup_t group);
@@ -83,6 +83,7 @@ Timer_t TimerInit(TimerConfig_t config) {
     assert(config.timerID < TIMER_COUNT);
     assert(config.priority <= 7);
     assert(0 < config.period);
+    assert(!(config.timerID == SYSTICK && config.isADCTrigger));
 
     Timer_t timer = {
         .timerID=config.timerID,
@@ -153,6 +154,12 @@ Timer_t TimerInit(TimerConfig_t config) {
             config.isPeriodic ? 0x00000002 : 0x00000001;
         GET_REG(GPTM_BASE + timerOffset + GPTMTAILR_OFFSET) = config.period - 1;
         GET_REG(GPTM_BASE + timerOffset + GPTMTAPR_OFFSET)  = config.prescale;
+
+        /* Concatenated wide timers hold the upper 32 bits of the reload
+           value in GPTMTBILR. */
+        if (ID >= WTIMER_0A && !config.isIndividual) {
+            GET_REG(GPTM_BASE + timerOffset + GPTMTBILR_OFFSET) = (config.period - 1) >> 32;
+        }
     } else { /* Timer B. */
         GET_REG(GPTM_BASE + timerOffset + GPTMTBMR_OFFSET)  =
             config.isPeriodic ? 0x00000002 : 0x00000001;
@@ -164,26 +171,35 @@ Timer_t TimerInit(TimerConfig_t config) {
     GET_REG(GPTM_BASE + timerOffset + GPTMICR_OFFSET) |=
         ((ID % 2) == 0) ? TIMERXA_ICR_TATOCINT: TIMERXB_ICR_TATOCINT;
 
-    /* 8. Arm timeout interrupt. */
-    GET_REG(GPTM_BASE + timerOffset + GPTMIMR_OFFSET) |=
-        ((ID % 2) == 0) ? 0x00000001 : 0x00000100;
-
-    /* 9. Set timer interrupt priority. */
-    uint32_t mask = 0xFFFFFFFF;
-    uint32_t intVal = config.priority << 5;
-
-    /* Our magic number is 8 since to shift a hex value one hex position, we do
-       4 binary shifts. To do it twice; 8 binary shifts. Our output should
-       something like this for priority 2: 0xFF00FFFF, 0x00400000. */
-    mask &= ~(0xFF << (TimerInterruptSettings[ID].priorityIdx * 8));
-    intVal = intVal << (TimerInterruptSettings[ID].priorityIdx * 8);
-    (*TimerInterruptSettings[ID].NVIC_PRI_ADDR) =
-        ((*TimerInterruptSettings[ID].NVIC_PRI_ADDR)&mask)|intVal;
+    /* A timer that only triggers the ADC has nothing to do on timeout. */
+    if (config.timerTask != NULL || !config.isADCTrigger) {
+        /* 8. Arm timeout interrupt. */
+        GET_REG(GPTM_BASE + timerOffset + GPTMIMR_OFFSET) |=
+            ((ID % 2) == 0) ? 0x00000001 : 0x00000100;
+
+        /* 9. Set timer interrupt priority. */
+        uint32_t mask = 0xFFFFFFFF;
+        uint32_t intVal = config.priority << 5;
+
+        /* Our magic number is 8 since to shift a hex value one hex position, we do
+           4 binary shifts. To do it twice; 8 binary shifts. Our output should
+           something like this for priority 2: 0xFF00FFFF, 0x00400000. */
+        mask &= ~(0xFF << (TimerInterruptSettings[ID].priorityIdx * 8));
+        intVal = intVal << (TimerInterruptSettings[ID].priorityIdx * 8);
+        (*TimerInterruptSettings[ID].NVIC_PRI_ADDR) =
+            ((*TimerInterruptSettings[ID].NVIC_PRI_ADDR)&mask)|intVal;
+
+        /* 10. Enable IRQ X in NVIC. */
+        (*TimerInterruptSettings[ID].NVIC_EN_ADDR) = 1 << TimerInterruptSettings[ID].IRQ;
+    }
 
-    /* 10. Enable IRQ X in NVIC. */
-    (*TimerInterruptSettings[ID].NVIC_EN_ADDR) = 1 << TimerInterruptSettings[ID].IRQ;
+    /* 11. Enable the ADC trigger output (TAOTE, TBOTE). */
+    if (config.isADCTrigger) {
+        GET_REG(GPTM_BASE + timerOffset + GPTMCTL_OFFSET) |=
+            ((ID % 2) == 0) ? 0x00000020 : 0x00002000;
+    }
 
-    /* 11. Enable timer after setup. */
+    /* 12. Enable timer after setup. */
     GET_REG(GPTM_BASE + timerOffset + GPTMCTL_OFFSET) |=
         ((ID % 2) == 0) ? 0x00000001 : 0x00000100;
 
@@ -244,9 +260,10 @@ void TimerStop(Timer_t timer) {
        number, 16, is the enumerated value of WTIMER_2A. */
     else timerOffset = 0x1000 * (uint32_t)((ID-16) >> 1) + 0x0001C000;
 
-    /* 2. Disable timer during setup. */
+    /* 2. Disable timer. Only the enable bit is cleared, so that TimerStart
+          resumes with the same configuration, such as the ADC trigger. */
     GET_REG(GPTM_BASE + timerOffset + GPTMCTL_OFFSET) &=
-        ((ID % 2) == 0) ? 0xFFFFFF00 : 0xFFFFFF00FF;
+        ((ID % 2) == 0) ? ~0x00000001 : ~0x00000100;
 }
 
 void TimerStart(Timer_t timer) {
@@ -269,6 +286,46 @@ void TimerStart(Timer_t timer) {
         ((ID % 2) == 0) ? 0x00000001 : 0x00000100;
 }
 
+uint64_t TimerGetValue(Timer_t timer) {
+    /* Initialization asserts. */
+    assert(timer.timerID < TIMER_COUNT);
+
+    uint8_t ID = timer.timerID;
+
+    /* Special case for SYSTICK. */
+    if (ID == SYSTICK) {
+        return GET_REG(PERIPHERALS_BASE + SYSTICK_CURR_OFFSET) & 0x00FFFFFF;
+    }
+
+    /* 1. We'll generate the timer offset to find the correct addresses for each
+       timer. */
+    uint32_t timerOffset = 0;
+    /* Timers TIMER_0A to WTIMER_1B. */
+    if (ID < WTIMER_2A) timerOffset = 0x1000 * (uint32_t)(ID >> 1);
+    /* Timers WTIMER_2A to WTIMER_5B. Jump the base to 0x4004.C000. Our magic
+       number, 16, is the enumerated value of WTIMER_2A. */
+    else timerOffset = 0x1000 * (uint32_t)((ID-16) >> 1) + 0x0001C000;
+
+    /* 2. Individual timers and the B side read their own register. */
+    if ((ID % 2) == 1) {
+        return (uint32_t)GET_REG(GPTM_BASE + timerOffset + GPTMTBR_OFFSET);
+    }
+    if (ID < WTIMER_0A || GET_REG(GPTM_BASE + timerOffset + GPTMCFG_OFFSET) != 0) {
+        return (uint32_t)GET_REG(GPTM_BASE + timerOffset + GPTMTAR_OFFSET);
+    }
+
+    /* 3. Concatenated wide timers hold the upper 32 bits in GPTMTBR. Reread
+          it until it is unchanged across the read of the lower 32 bits, so a
+          borrow between the halves is not missed. */
+    uint32_t upper;
+    uint32_t lower;
+    do {
+        upper = GET_REG(GPTM_BASE + timerOffset + GPTMTBR_OFFSET);
+        lower = GET_REG(GPTM_BASE + timerOffset + GPTMTAR_OFFSET);
+    } while (upper != (uint32_t)GET_REG(GPTM_BASE + timerOffset + GPTMTBR_OFFSET));
+    return ((uint64_t)upper << 32) | lower;
+}
+
 uint32_t freqToPeriod(uint32_t freq, uint32_t maxFreq) {
     return (uint32_t) ceil(maxFreq/freq);
 }
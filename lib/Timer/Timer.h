@@ -118,6 +118,18 @@ typedef struct TimerConfig {
      *       timerArgs inside of their timerTask function implementation.
      */
     uint32_t * timerArgs;
+
+    /**
+     * @brief Whether each timeout of the Timer triggers the ADC sequencers
+     *        configured with ADC_TRIGGER_TIMER. If set and timerTask is NULL,
+     *        the timeout interrupt is not armed, so the CPU is not woken up on
+     *        every period.
+     *
+     * Default is false (No ADC trigger).
+     *
+     * @note Not supported by SYSTICK.
+     */
+    bool isADCTrigger;
 } TimerConfig_t;
 
 /** @brief Timer_t is a struct containing user relevant data of a timer. */
@@ -162,6 +174,15 @@ void TimerStop(Timer_t timer);
  */
 void TimerStart(Timer_t timer);
 
+/**
+ * @brief TimerGetValue returns the current count of a timer. Timers count
+ *        down from their period to 0.
+ *
+ * @param timer The timer to read.
+ * @return The current count. Concatenated wide timers return all 64 bits.
+ */
+uint64_t TimerGetValue(Timer_t timer);
+
 /**
  * @brief freqToPeriod converts a desired frequency into the equivalent period
  *        in cycles given the base system clock, rounded up.
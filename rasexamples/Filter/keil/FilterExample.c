@@ -10,6 +10,28 @@
  * __MAIN__ = 0: demonstrates initialization and execution of a SMA Filter.
  * __MAIN__ = 1: demonstrates initialization and execution of a Median Filter.
  * __MAIN__ = 2: demonstrates initialization and execution of a Kalman Filter.
+ * __MAIN__ = 3: demonstrates initialization and execution of a heap mode
+ *               Median Filter.
+ * __MAIN__ = 4: demonstrates initialization and execution of an EMA Filter in
+ *               float and integer mode.
+ * __MAIN__ = 5: demonstrates initialization and execution of SMA and EMA
+ *               filter banks over 8 channel sample vectors.
+ * __MAIN__ = 6: demonstrates initialization and execution of steady state
+ *               float and Q16 Kalman Filters.
+ * __MAIN__ = 7: demonstrates initialization and execution of a constant
+ *               velocity (2 state) Kalman Filter.
+ * __MAIN__ = 8: demonstrates initialization and execution of float and fixed
+ *               point Biquad Filter cascades.
+ * __MAIN__ = 9: demonstrates initialization and execution of a FIR Filter in
+ *               single sample, block and decimating mode.
+ * __MAIN__ = 10: demonstrates initialization and execution of an integer mode
+ *                SMA Filter on raw ADC codes.
+ * __MAIN__ = 11: demonstrates initialization and execution of a CIC
+ *                decimation Filter on bursts of raw ADC codes.
+ * __MAIN__ = 12: demonstrates initialization and execution of a Median to
+ *                Kalman Filter Pipeline.
+ * __MAIN__ = 13: demonstrates initialization and execution of a Hampel
+ *                outlier rejection Filter.
  */
 #define __MAIN__ 0
 
@@ -24,6 +46,14 @@
 #include <raslib/Filter/SMAFilter.h>
 #include <raslib/Filter/MedianFilter.h>
 #include <raslib/Filter/KalmanFilter.h>
+#include <raslib/Filter/EMAFilter.h>
+#include <raslib/Filter/FilterBank.h>
+#include <raslib/Filter/KalmanVectorFilter.h>
+#include <raslib/Filter/BiquadFilter.h>
+#include <raslib/Filter/FIRFilter.h>
+#include <raslib/Filter/CICFilter.h>
+#include <raslib/Filter/FilterPipeline.h>
+#include <raslib/Filter/HampelFilter.h>
 
 
 #if __MAIN__ == 0
@@ -293,4 +323,724 @@ int main(void) {
         }
     }
 }
-#endif
+#elif __MAIN__ == 3
+static float buffer[5] = { 0.0 };
+static int16_t indexBuffer[10] = { 0 };
+static MedianFilter_t medianFilter;
+
+void checkMacro(MedianFilter_t * filter, float expectedVal) {
+    float result = MedianFilterGetSample(filter);
+    assert((int) result*100 == (int)expectedVal*100);
+}
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of a heap mode median filter.
+     *        It should produce the same outputs as the scan mode median filter.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        FilterConfig_t filterConfig = {
+            .type=FILTER_MEDIAN,
+            .buffer=buffer,
+            .bufferSize=5
+        };
+        medianFilter = MedianFilterHeapInit(filterConfig, indexBuffer);
+
+        /* Test 1. Read while empty. */
+        checkMacro(&medianFilter, 0.0);
+
+        /* Test 2. Clear and read. */
+        MedianFilterAddSample(&medianFilter, 10.0);
+        MedianFilterClear(&medianFilter);
+        checkMacro(&medianFilter, 0.0);
+
+        /* Test 3. Read after many writes. */
+        float testcase[20][2] = {
+            {10.0, 0}, // Input, expected median output
+            {10.0, 0}, // Fixed input.
+            {10.0, 10},
+            {10.0, 10},
+            {10.0, 10},
+            {11.0, 10},// Incrementing series.
+            {12.0, 10},
+            {13.0, 11},
+            {13.0, 12},
+            {13.0, 13},
+            {0.00, 13}, // Reset.
+            {0.00, 13},
+            {0.00, 0},
+            {0.00, 0},
+            {0.00, 0},
+            {5.45, 0},  // Random series.
+            {10.2, 0},
+            {7.00, 5.45},
+            {1.50, 5.45},
+            {15.0, 7.00}
+        };
+        /* Add 20 samples and check the expected median. */
+        for (int i = 0; i < 20; ++i) {
+            MedianFilterAddSample(&medianFilter, testcase[i][0]);
+
+            /* Assert the expected filter output at every point */
+            checkMacro(&medianFilter, testcase[i][1]);
+        }
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#elif __MAIN__ == 4
+static EMAFilter_t floatFilter;
+static EMAFilter_t intFilter;
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of an EMA filter.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        /* The EMA filter does not use a buffer. */
+        FilterConfig_t filterConfig = {
+            .type=FILTER_EMA,
+            .buffer=NULL,
+            .bufferSize=0
+        };
+        floatFilter = EMAFilterInit(filterConfig, 0.125);
+        intFilter = EMAFilterIntInit(filterConfig, 3);
+
+        /* Test 1. Read while empty. */
+        assert(EMAFilterGetIntSample(&intFilter) == 0);
+
+        /* Test 2. The first sample seeds the filter. */
+        EMAFilterAddSample(&floatFilter, 1000.0);
+        EMAFilterAddIntSample(&intFilter, 1000);
+        assert(EMAFilterGetIntSample(&floatFilter) == 1000);
+        assert(EMAFilterGetIntSample(&intFilter) == 1000);
+
+        /* Test 3. Step response. Both modes should match within a code and
+           settle on the new value. */
+        for (int i = 0; i < 64; ++i) {
+            EMAFilterAddSample(&floatFilter, 2000.0);
+            EMAFilterAddIntSample(&intFilter, 2000);
+            float diff = EMAFilterGetSample(&floatFilter) - EMAFilterGetSample(&intFilter);
+            assert(-1.0 < diff && diff < 1.0);
+        }
+        assert(EMAFilterGetIntSample(&intFilter) == 2000);
+
+        /* Test 4. Clear and read. */
+        EMAFilterClear(&intFilter);
+        assert(EMAFilterGetIntSample(&intFilter) == 0);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#elif __MAIN__ == 5
+static uint16_t history[4 * 8] = { 0 };
+static FilterBank_t smaBank;
+static FilterBank_t emaBank;
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of SMA and EMA filter banks.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        FilterBankConfig_t smaConfig = {
+            .type=FILTER_SMA,
+            .numChannels=8,
+            .history=history,
+            .windowSize=4
+        };
+        smaBank = FilterBankInit(smaConfig);
+
+        FilterBankConfig_t emaConfig = {
+            .type=FILTER_EMA,
+            .numChannels=8,
+            .shift=2
+        };
+        emaBank = FilterBankInit(emaConfig);
+
+        /* Test 1. Read while empty. */
+        assert(FilterBankGetSample(&smaBank, 0) == 0);
+
+        /* Test 2. Add 8 vectors where channel i reads i * 100, then a spike
+           vector. Channel i of the SMA bank should average the last 4. */
+        uint16_t samples[8];
+        uint16_t outputs[8];
+        uint8_t i, j;
+        for (j = 0; j < 8; ++j) {
+            for (i = 0; i < 8; ++i) samples[i] = i * 100;
+            FilterBankAddSamples(&smaBank, samples);
+            FilterBankAddSamples(&emaBank, samples);
+        }
+        for (i = 0; i < 8; ++i) samples[i] = i * 100 + 400;
+        FilterBankAddSamples(&smaBank, samples);
+        FilterBankAddSamples(&emaBank, samples);
+
+        FilterBankGetSamples(&smaBank, outputs);
+        for (i = 0; i < 8; ++i) assert(outputs[i] == i * 100 + 100);
+
+        FilterBankGetSamples(&emaBank, outputs);
+        for (i = 0; i < 8; ++i) assert(outputs[i] == i * 100 + 100);
+
+        /* Test 3. Clear and read. */
+        FilterBankClear(&smaBank);
+        assert(FilterBankGetSample(&smaBank, 7) == 0);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#elif __MAIN__ == 6
+static float buffer[5] = { 0.0 };
+static KalmanFilter_t dynamicFilter;
+static KalmanFilter_t steadyFilter;
+static KalmanFilter_t fixedFilter;
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of steady state Kalman filters
+     *        against the dynamic gain Kalman filter.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        FilterConfig_t filterConfig = {
+            .type=FILTER_KALMAN,
+            .buffer=buffer,
+            .bufferSize=5
+        };
+        dynamicFilter = KalmanFilterInit(filterConfig, 2000.0, 25, 10, 0.15);
+        steadyFilter = KalmanFilterSteadyStateInit(filterConfig, 2000.0, 10, 0.15, false);
+        fixedFilter = KalmanFilterSteadyStateInit(filterConfig, 2000.0, 10, 0.15, true);
+
+        /* Feed 200 noisy ADC codes around 2000. Once the dynamic gain has
+           converged, all three filters should agree. */
+        uint16_t i;
+        for (i = 0; i < 200; i++) {
+            int16_t sample = 2000 + (rand()%41) - 20;
+            KalmanFilterAddSample(&dynamicFilter, sample);
+            KalmanFilterAddSample(&steadyFilter, sample);
+            KalmanFilterAddIntSample(&fixedFilter, sample);
+        }
+        float diff = KalmanFilterGetSample(&dynamicFilter) - KalmanFilterGetSample(&steadyFilter);
+        assert(-0.1 < diff && diff < 0.1);
+        diff = KalmanFilterGetSample(&steadyFilter) - KalmanFilterGetSample(&fixedFilter);
+        assert(-0.1 < diff && diff < 0.1);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#elif __MAIN__ == 7
+static float buffer[KALMAN_VECTOR_BUFFER_SIZE(2)] = { 0.0 };
+static KalmanVectorFilter_t kalmanFilter;
+float history[100][3] = { 0.0 };
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of a constant velocity Kalman
+     *        filter tracking a target moving at 3 units/s.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        FilterConfig_t filterConfig = {
+            .type=FILTER_KALMAN_VECTOR,
+            .buffer=buffer,
+            .bufferSize=KALMAN_VECTOR_BUFFER_SIZE(2)
+        };
+        /* 100 Hz samples, position starts at 0. */
+        kalmanFilter = KalmanVectorFilterInit(filterConfig, 2, 0.01, 0.0, 100, 4, 1);
+
+        /* Add 100 samples of a target starting at 5 moving at 3 units/s, with
+           +/- 2 units of noise. */
+        uint16_t i;
+        for (i = 0; i < 100; i++) {
+            history[i][0] = 5.0 + 3.0 * i * 0.01 + (rand()%101)/100.0*4.0-2.0;
+            KalmanVectorFilterAddSample(&kalmanFilter, history[i][0]);
+
+            /* Read the position and velocity estimate at every point. */
+            history[i][1] = KalmanVectorFilterGetSample(&kalmanFilter);
+            history[i][2] = KalmanVectorFilterGetState(&kalmanFilter, 1);
+        }
+
+        /* The position estimate should be within the noise band. */
+        float diff = KalmanVectorFilterGetSample(&kalmanFilter) - (5.0 + 3.0 * 0.99);
+        assert(-2.0 < diff && diff < 2.0);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {
+            /* Put a breakpoint here and check the history array. */
+        }
+    }
+}
+#elif __MAIN__ == 8
+static float buffer[4] = { 0.0 };
+static int64_t fixedState[4] = { 0 };
+static BiquadCoefficients_t coefficients[2];
+static BiquadFixedCoefficients_t fixedCoefficients[2];
+static BiquadFilter_t floatFilter;
+static BiquadFilter_t fixedFilter;
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of a 4th order Butterworth low
+     *        pass filter, built from two biquad stages, in float and fixed
+     *        point.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        /* 50 Hz cutoff at a 1 kHz sample rate. */
+        coefficients[0] = BiquadCoefficientsLowPass(50, 1000, 0.5412);
+        coefficients[1] = BiquadCoefficientsLowPass(50, 1000, 1.3066);
+        BiquadCoefficientsToFixed(coefficients, fixedCoefficients, 2);
+
+        FilterConfig_t filterConfig = {
+            .type=FILTER_BIQUAD,
+            .buffer=buffer,
+            .bufferSize=4
+        };
+        floatFilter = BiquadFilterInit(filterConfig, coefficients, 2);
+        fixedFilter = BiquadFilterFixedInit(filterConfig, fixedCoefficients, 2, fixedState);
+
+        /* Test 1. Read while empty. */
+        assert(BiquadFilterGetSample(&floatFilter) == 0.0);
+
+        /* Test 2. A 500 Hz square wave around a DC level of 2000 ADC codes
+           should be removed, leaving the DC level. */
+        float floatBlock[64];
+        int16_t fixedBlock[64];
+        uint16_t i, j;
+        for (j = 0; j < 8; ++j) {
+            for (i = 0; i < 64; ++i) {
+                floatBlock[i] = (i % 2) ? 2100.0 : 1900.0;
+                fixedBlock[i] = (int16_t)floatBlock[i] << 3;
+            }
+            BiquadFilterProcessBlock(&floatFilter, floatBlock, floatBlock, 64);
+            BiquadFilterProcessBlockQ15(&fixedFilter, fixedBlock, fixedBlock, 64);
+        }
+        float diff = BiquadFilterGetSample(&floatFilter) - 2000.0;
+        assert(-5.0 < diff && diff < 5.0);
+        diff = (fixedBlock[63] >> 3) - 2000.0;
+        assert(-5.0 < diff && diff < 5.0);
+
+        /* Test 3. Clear and read. */
+        BiquadFilterClear(&floatFilter);
+        assert(BiquadFilterGetSample(&floatFilter) == 0.0);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#elif __MAIN__ == 9
+static float buffer[8] = { 0.0 };
+static const float taps[4] = { 0.4, 0.3, 0.2, 0.1 };
+static FIRFilter_t firFilter;
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of a 4 tap FIR filter.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        FilterConfig_t filterConfig = {
+            .type=FILTER_FIR,
+            .buffer=buffer,
+            .bufferSize=8
+        };
+        firFilter = FIRFilterInit(filterConfig, taps, 4);
+
+        /* Test 1. Read while empty. */
+        assert(FIRFilterGetSample(&firFilter) == 0.0);
+
+        /* Test 2. An impulse walks out through the taps, newest first. */
+        float diff;
+        assert(FIRFilterAddSample(&firFilter, 10.0));
+        diff = FIRFilterGetSample(&firFilter) - 4.0;
+        assert(-0.001 < diff && diff < 0.001);
+        FIRFilterAddSample(&firFilter, 0.0);
+        FIRFilterAddSample(&firFilter, 0.0);
+        diff = FIRFilterGetSample(&firFilter) - 2.0;
+        assert(-0.001 < diff && diff < 0.001);
+        FIRFilterAddSample(&firFilter, 0.0);
+        FIRFilterAddSample(&firFilter, 0.0);
+        assert(FIRFilterGetSample(&firFilter) == 0.0);
+
+        /* Test 3. A block of a constant converges to the constant, since the
+           taps sum to 1. */
+        float block[8] = { 5.0, 5.0, 5.0, 5.0, 5.0, 5.0, 5.0, 5.0 };
+        assert(FIRFilterProcessBlock(&firFilter, block, block, 8) == 8);
+        diff = block[7] - 5.0;
+        assert(-0.001 < diff && diff < 0.001);
+
+        /* Test 4. Decimate by 4. Only every 4th sample produces an output. */
+        firFilter = FIRFilterDecimateInit(filterConfig, taps, 4, 4);
+        assert(!FIRFilterAddSample(&firFilter, 1.0));
+        assert(!FIRFilterAddSample(&firFilter, 1.0));
+        assert(!FIRFilterAddSample(&firFilter, 1.0));
+        assert(FIRFilterAddSample(&firFilter, 1.0));
+        float decimated[3];
+        float input[8] = { 2.0, 2.0, 2.0, 2.0, 3.0, 3.0, 3.0, 3.0 };
+        assert(FIRFilterProcessBlock(&firFilter, input, decimated, 8) == 2);
+        diff = decimated[1] - 3.0;
+        assert(-0.001 < diff && diff < 0.001);
+
+        /* Test 5. Clear and read. */
+        FIRFilterClear(&firFilter);
+        assert(FIRFilterGetSample(&firFilter) == 0.0);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#elif __MAIN__ == 10
+static uint16_t history[4] = { 0 };
+static SMAFilter_t smaFilter;
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of an integer mode simple moving
+     *        average filter.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        FilterConfig_t filterConfig = {
+            .type=FILTER_SMA,
+            .buffer=NULL,
+            .bufferSize=4
+        };
+        smaFilter = SMAFilterIntInit(filterConfig, history);
+
+        /* Test 1. Read while empty. */
+        assert(SMAFilterGetIntSample(&smaFilter) == 0);
+
+        /* Test 2. Partially filled window. */
+        SMAFilterAddIntSample(&smaFilter, 4095);
+        SMAFilterAddIntSample(&smaFilter, 0);
+        assert(SMAFilterGetIntSample(&smaFilter) == 2047);
+        assert(SMAFilterGetSample(&smaFilter) == 2047.5);
+
+        /* Test 3. Full window, then roll over the oldest samples. */
+        SMAFilterAddIntSample(&smaFilter, 100);
+        SMAFilterAddIntSample(&smaFilter, 200);
+        assert(SMAFilterGetIntSample(&smaFilter) == 1098);
+        SMAFilterAddIntSample(&smaFilter, 300);
+        SMAFilterAddIntSample(&smaFilter, 400);
+        assert(SMAFilterGetIntSample(&smaFilter) == 250);
+
+        /* Test 4. Clear and read. */
+        SMAFilterClear(&smaFilter);
+        assert(SMAFilterGetIntSample(&smaFilter) == 0);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#elif __MAIN__ == 11
+static CICFilter_t cicFilter;
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of a 3rd order CIC filter
+     *        decimating by 16.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        FilterConfig_t filterConfig = {
+            .type=FILTER_CIC,
+            .buffer=NULL,
+            .bufferSize=0
+        };
+        cicFilter = CICFilterInit(filterConfig, 3, 16);
+
+        /* Test 1. Read while empty. */
+        assert(CICFilterGetIntSample(&cicFilter) == 0);
+
+        /* Test 2. Only every 16th sample produces an output. */
+        uint16_t i;
+        for (i = 0; i < 15; ++i) {
+            assert(!CICFilterAddIntSample(&cicFilter, 1000));
+        }
+        assert(CICFilterAddIntSample(&cicFilter, 1000));
+
+        /* Test 3. A burst alternating between two codes settles to their mean
+           once the filter has seen order * decimation samples. */
+        uint16_t burst[64];
+        uint16_t output[5];
+        for (i = 0; i < 64; ++i) {
+            burst[i] = (i % 2) ? 3000 : 1000;
+        }
+        assert(CICFilterAddIntSamples(&cicFilter, burst, 64, output) == 4);
+        assert(output[3] == 2000);
+        assert(CICFilterGetIntSample(&cicFilter) == 2000);
+
+        /* Test 4. Clear and read. */
+        CICFilterClear(&cicFilter);
+        assert(CICFilterGetIntSample(&cicFilter) == 0);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#elif __MAIN__ == 12
+static float medianBuffer[3] = { 0.0 };
+static float kalmanBuffer[2] = { 0.0 };
+static MedianFilter_t medianFilter;
+static KalmanFilter_t kalmanFilter;
+static FilterPipeline_t pipeline;
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of a median filter feeding a
+     *        Kalman filter through a filter pipeline.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        FilterConfig_t medianConfig = {
+            .type=FILTER_MEDIAN,
+            .buffer=medianBuffer,
+            .bufferSize=3
+        };
+        medianFilter = MedianFilterInit(medianConfig);
+
+        FilterConfig_t kalmanConfig = {
+            .type=FILTER_KALMAN,
+            .buffer=kalmanBuffer,
+            .bufferSize=2
+        };
+        kalmanFilter = KalmanFilterSteadyStateInit(kalmanConfig, 100.0, 1.0, 1.0, false);
+
+        void * stages[2] = { &medianFilter, &kalmanFilter };
+        pipeline = FilterPipelineInit(stages, 2);
+
+        /* Test 1. Read while empty. */
+        assert(FilterPipelineGetSample(&pipeline) == 0.0);
+
+        /* Test 2. A single spike is removed by the median stage before it
+           reaches the Kalman stage, so the output never overshoots. */
+        float block[8] = { 100.0, 100.0, 100.0, 4000.0, 100.0, 100.0, 100.0, 100.0 };
+        FilterPipelineProcessBlock(&pipeline, block, block, 8);
+        uint8_t i;
+        for (i = 0; i < 8; ++i) {
+            assert(block[i] <= 100.0);
+        }
+
+        /* Test 3. Single samples go through the same stages and settle on the
+           input. */
+        for (i = 0; i < 8; ++i) {
+            FilterPipelineAddSample(&pipeline, 100.0);
+        }
+        float diff = FilterPipelineGetSample(&pipeline) - 100.0;
+        assert(-0.01 < diff && diff < 0.01);
+
+        /* Test 4. Clear and read. */
+        FilterPipelineClear(&pipeline);
+        assert(FilterPipelineGetSample(&pipeline) == 0.0);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#elif __MAIN__ == 13
+static float buffer[14] = { 0.0 };
+static HampelFilter_t hampelFilter;
+
+int main(void) {
+    /**
+     * @brief This program tests the execution of a Hampel filter over a 7
+     *        sample window.
+     */
+    PLLInit(BUS_80_MHZ);
+
+    /* Initialize PF3 as a GPIO output. This is associated with the GREEN led on
+       the TM4C. */
+    GPIOConfig_t PF3Config = {
+        .pin=PIN_F3,
+        .pull=GPIO_PULL_DOWN,
+        .isOutput=true,
+        .alternateFunction=0,
+        .isAnalog=false,
+        .drive=GPIO_DRIVE_2MA,
+        .enableSlew=false
+    };
+    GPIOInit(PF3Config);
+
+    while (1) {
+        FilterConfig_t filterConfig = {
+            .type=FILTER_HAMPEL,
+            .buffer=buffer,
+            .bufferSize=14
+        };
+        hampelFilter = HampelFilterInit(filterConfig, 7, 3.0, 1.0);
+
+        /* Test 1. Read while empty. */
+        assert(HampelFilterGetSample(&hampelFilter) == 0.0);
+
+        /* Test 2. Samples near the window median pass through unchanged. */
+        float samples[7] = { 1000.0, 1002.0, 999.0, 1001.0, 1000.0, 998.0, 1001.0 };
+        uint8_t i;
+        for (i = 0; i < 7; ++i) {
+            assert(!HampelFilterAddSample(&hampelFilter, samples[i]));
+            assert(HampelFilterGetSample(&hampelFilter) == samples[i]);
+        }
+
+        /* Test 3. A full scale spike is replaced by the window median. */
+        assert(HampelFilterAddSample(&hampelFilter, 4095.0));
+        assert(HampelFilterGetSample(&hampelFilter) == 1001.0);
+        assert(HampelFilterGetRejectedCount(&hampelFilter) == 1);
+
+        /* Test 4. The next clean sample passes through again. */
+        assert(!HampelFilterAddSample(&hampelFilter, 1000.0));
+        assert(HampelFilterGetSample(&hampelFilter) == 1000.0);
+
+        /* Test 5. Clear and read. */
+        HampelFilterClear(&hampelFilter);
+        assert(HampelFilterGetSample(&hampelFilter) == 0.0);
+        assert(HampelFilterGetRejectedCount(&hampelFilter) == 0);
+
+        GPIOSetBit(PIN_F3, 1);
+        while (1) {}
+    }
+}
+#endif
\ No newline at end of file
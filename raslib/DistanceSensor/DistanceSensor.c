@@ -31,9 +31,15 @@
  * - this driver allows you to initialize distance sensors, read an unsigned
  *   16-bit value from the sensors, and set up periodic interrupts where data
  *   is read from a sensor at a desired frequency.
+ * - With isEventDriven, the thresholding is offloaded to an ADC digital
+ *   comparator. The timer triggers the ADC in hardware and the CPU is only
+ *   interrupted when the sensor crosses the threshold.
+ * - With isScheduled, the pin is sampled by the ADC scheduler, sharing
+ *   sequencers with other sensors instead of claiming one.
  */
 
 /** General imports. */
+#include <stdlib.h>
 #include <assert.h>
 
 /** Device specific imports. */
@@ -54,6 +60,9 @@ static struct DistanceSensorSettings {
     /** @brief The thresholding value inserted into DistanceSensorGetBool. */
     uint16_t threshold;
 
+    /** @brief User function called on a threshold crossing. */
+    void (*thresholdTask)(bool isAboveThreshold);
+
 } sensorSettings[NUM_ADC_MODULES * NUM_ADC_SEQUENCERS];
 
 /**
@@ -74,15 +83,44 @@ void DistanceSensorReadInterrupt(uint32_t * args) {
     }
 }
 
+/**
+ * @brief DistanceSensorThresholdInterrupt is the generic handler passed to
+ *        the ADC digital comparator. It forwards the crossing to the user.
+ *
+ * @param isHigh Whether the sensor is now at or above the threshold.
+ * @param args A pointer to a list of arguments. In this function, arg[0] should
+ *             be a pointer to an entry in sensorSettings.
+ */
+void DistanceSensorThresholdInterrupt(bool isHigh, uint32_t * args) {
+    struct DistanceSensorSettings * setting = ((struct DistanceSensorSettings *)args);
+    if (setting->thresholdTask != NULL) {
+        setting->thresholdTask(isHigh);
+    }
+}
+
 DistanceSensor_t DistanceSensorInit(DistanceSensorConfig_t config) {
     /* Initialization asserts. */
     assert(config.repeatFrequency <= 100);
     assert(config.threshold <= 4095);
+    assert(!config.isEventDriven || (config.isThresholded && 1 <= config.repeatFrequency));
+    assert(config.hysteresis <= config.threshold);
+    assert(!config.isScheduled || (!config.isEventDriven && 1 <= config.repeatFrequency));
 
     DistanceSensor_t sensor = {
-        .value=0
+        .value=0,
+        .isScheduled=config.isScheduled
     };
 
+    /* Request the pin from the ADC scheduler, which picks the sequencer. */
+    if (config.isScheduled) {
+        ADCChannelConfig_t channelConfig = {
+            .pin=config.pin,
+            .frequency=config.repeatFrequency
+        };
+        sensor.channel = ADCSchedulerAddChannel(channelConfig);
+        return sensor;
+    }
+
     /* Set up the appropriate ADC. */
     ADCConfig_t adcConfig = {
         .pin=config.pin,
@@ -90,10 +128,37 @@ DistanceSensor_t DistanceSensorInit(DistanceSensorConfig_t config) {
         .sequencer=config.sequencer,
         .position=ADC_SEQPOS_0,
         .isNotEndSample=false,
+        .priority=5,
+        .trigger=config.isEventDriven ? ADC_TRIGGER_TIMER : ADC_TRIGGER_PROCESSOR
     };
     ADC_t adc = ADCInit(adcConfig);
     sensor.adc = adc;
-    
+
+    /* Offload the threshold to a digital comparator, sampled by the timer in
+       hardware. */
+    if (config.isEventDriven) {
+        uint8_t idx = config.module * 4 + config.sequencer;
+        sensorSettings[idx].thresholdTask = config.thresholdTask;
+
+        ADCComparatorConfig_t comparatorConfig = {
+            .adc=adc,
+            .lowThreshold=config.threshold - config.hysteresis,
+            .highThreshold=config.threshold,
+            .comparatorTask=DistanceSensorThresholdInterrupt,
+            .comparatorArgs=(uint32_t *)&sensorSettings[idx]
+        };
+        sensor.comparator = ADCComparatorInit(comparatorConfig);
+
+        TimerConfig_t timerConfig = {
+            .timerID=config.timer,
+            .period=freqToPeriod(config.repeatFrequency, MAX_FREQ),
+            .isPeriodic=true,
+            .isADCTrigger=true
+        };
+        TimerInit(timerConfig);
+        return sensor;
+    }
+
     /* Set up a recurring timer on TIMER_3 with priority 5. */
     if (1 <= config.repeatFrequency && config.repeatFrequency <= 100) {
         uint8_t idx = config.module * 4 + config.sequencer;
@@ -117,14 +182,22 @@ DistanceSensor_t DistanceSensorInit(DistanceSensorConfig_t config) {
 }
 
 void DistanceSensorGetInt(DistanceSensor_t * sensor) {
+    if (sensor->isScheduled) {
+        sensor->value = ADCSchedulerRead(sensor->channel);
+        return;
+    }
     ADCSampleSequencer(sensor->adc.module, sensor->adc.sequencer, &(sensor->value));
 }
 
 void DistanceSensorGetBool(DistanceSensor_t * sensor, uint16_t threshold) {
-    ADCSampleSequencer(sensor->adc.module, sensor->adc.sequencer, &(sensor->value));
+    DistanceSensorGetInt(sensor);
     if (sensor->value >= threshold) {
         sensor->value = 1;
     } else {
         sensor->value = 0;
     }
 }
+
+void DistanceSensorGetEventBool(DistanceSensor_t * sensor) {
+    sensor->value = ADCComparatorIsHigh(sensor->comparator);
+}
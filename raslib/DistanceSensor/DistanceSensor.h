@@ -31,6 +31,11 @@
  * - this driver allows you to initialize distance sensors, read an unsigned
  *   16-bit value from the sensors, and set up periodic interrupts where data
  *   is read from a sensor at a desired frequency.
+ * - With isEventDriven, the thresholding is offloaded to an ADC digital
+ *   comparator. The timer triggers the ADC in hardware and the CPU is only
+ *   interrupted when the sensor crosses the threshold.
+ * - With isScheduled, the pin is sampled by the ADC scheduler, sharing
+ *   sequencers with other sensors instead of claiming one.
  */
 #pragma once 
 
@@ -39,6 +44,7 @@
 
 /** Device specific imports. */
 #include <lib/ADC/ADC.h>
+#include <lib/ADC/ADCScheduler.h>
 #include <lib/Timer/Timer.h>
 
 
@@ -87,6 +93,51 @@ typedef struct DistanceSensorConfig {
      */
     uint16_t threshold;
 
+    /**
+     * @brief Whether the thresholding is done in hardware by an ADC digital
+     * comparator instead of by DistanceSensorGetBool. The timer triggers the
+     * ADC directly at repeatFrequency, and thresholdTask is only called when
+     * the sensor crosses the threshold. Requires isThresholded and a
+     * repeatFrequency. Read the state with DistanceSensorGetEventBool.
+     * DistanceSensorGetInt and DistanceSensorGetBool are unavailable, since
+     * samples no longer reach the ADC FIFO.
+     *
+     * Default false.
+     */
+    bool isEventDriven;
+
+    /**
+     * @brief If isEventDriven is enabled, the sensor reads 1 once a sample is
+     * at or above threshold, and reads 0 again once a sample is below
+     * threshold - hysteresis. Fixed to [0, threshold].
+     *
+     * Default is 0.
+     */
+    uint16_t hysteresis;
+
+    /**
+     * @brief If isEventDriven is enabled, the function called from the ADC
+     * interrupt whenever the sensor crosses the threshold, with whether it is
+     * now at or above the threshold.
+     *
+     * Default is NULL (No function defined).
+     */
+    void (*thresholdTask)(bool isAboveThreshold);
+
+    /**
+     * @brief Whether the pin is sampled by the ADC scheduler at
+     * repeatFrequency, sharing sequencers with every other scheduled consumer,
+     * instead of on module and sequencer. module, sequencer and timer are then
+     * ignored, and DistanceSensorGetInt and
+     * DistanceSensorGetBool read the latest samples without
+     * converting. Requires a repeatFrequency. ADCSchedulerStart must be called
+     * once every scheduled consumer is initialized. Cannot be combined with
+     * isEventDriven.
+     *
+     * Default false.
+     */
+    bool isScheduled;
+
     /**
      * @brief The ADC module associated with the ADC Pin. There are two ADC
      * modules in the TM4C123GH6PM and both can operate simultaneously.
@@ -127,6 +178,15 @@ typedef struct DistanceSensor {
      * when called by DistanceSensorGetInt or DistanceSensorGetBool.
      */
     uint16_t value;
+
+    /** @brief The ADC digital comparator used if isEventDriven. */
+    ADCComparator_t comparator;
+
+    /** @brief The ADC scheduler channel used if isScheduled. */
+    ADCChannel_t channel;
+
+    /** @brief Whether the pin is sampled by the ADC scheduler. */
+    bool isScheduled;
 } DistanceSensor_t;
 
 /**
@@ -155,3 +215,12 @@ void DistanceSensorGetInt(DistanceSensor_t * sensor);
  * @param sensor A pointer to the DistanceSensor_t struct.
  */
 void DistanceSensorGetBool(DistanceSensor_t * sensor, uint16_t threshold);
+
+/**
+ * @brief DistanceSensorGetEventBool reads the thresholded state of an
+ * isEventDriven distance sensor into the value member of the DistanceSensor
+ * object, without sampling. The value is in the range [0, 1].
+ *
+ * @param sensor A pointer to the DistanceSensor_t struct.
+ */
+void DistanceSensorGetEventBool(DistanceSensor_t * sensor);
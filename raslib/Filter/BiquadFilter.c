@@ -0,0 +1,283 @@
+/**
+ * @file BiquadFilter.c
+ * @author agent (agent@local)
+ * @brief Biquad IIR cascade filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note Coefficient design source: Robert Bristow-Johnson's Audio EQ Cookbook,
+ *       https://www.w3.org/TR/audio-eq-cookbook/
+ */
+
+/** General imports. */
+#include <assert.h>
+#include <stdlib.h>
+#include <math.h>
+
+/** Device Specific imports. */
+#include <raslib/Filter/BiquadFilter.h>
+
+
+#define PI 3.14159265358979f
+
+/** @brief Number of fractional bits in fixed point coefficients. */
+#define BIQUAD_COEFF_FRAC_BITS 29
+
+BiquadFilter_t BiquadFilterInit(const FilterConfig_t config, const BiquadCoefficients_t * coefficients, const uint8_t numStages) {
+    /* Initialization asserts. */
+    assert(config.type == FILTER_BIQUAD);
+    assert(config.buffer != NULL);
+    assert(coefficients != NULL);
+    assert(numStages > 0);
+    assert(config.bufferSize >= 2 * numStages);
+
+    Filter_t filter = {
+        .type=config.type,
+        .buffer=config.buffer,
+        .bufferSize=config.bufferSize
+    };
+
+    BiquadFilter_t biquadFilter = {
+        .filter=filter,
+        .mode=BIQUAD_FLOAT,
+        .numStages=numStages,
+        .coefficients=coefficients,
+        .fixedCoefficients=NULL,
+        .fixedState=NULL,
+        .output=0
+    };
+    BiquadFilterClear(&biquadFilter);
+
+    return biquadFilter;
+}
+
+BiquadFilter_t BiquadFilterFixedInit(const FilterConfig_t config, const BiquadFixedCoefficients_t * coefficients, const uint8_t numStages, int64_t * state) {
+    /* Initialization asserts. */
+    assert(config.type == FILTER_BIQUAD);
+    assert(coefficients != NULL);
+    assert(state != NULL);
+    assert(numStages > 0);
+
+    Filter_t filter = {
+        .type=config.type,
+        .buffer=config.buffer,
+        .bufferSize=config.bufferSize
+    };
+
+    BiquadFilter_t biquadFilter = {
+        .filter=filter,
+        .mode=BIQUAD_FIXED,
+        .numStages=numStages,
+        .coefficients=NULL,
+        .fixedCoefficients=coefficients,
+        .fixedState=state,
+        .output=0
+    };
+    BiquadFilterClear(&biquadFilter);
+
+    return biquadFilter;
+}
+
+/**
+ * @brief BiquadFilterRun runs a block of samples through a float cascade.
+ *
+ * @param filter Float mode biquad filter.
+ * @param input Samples to add.
+ * @param output Filtered samples. May alias the input.
+ * @param numSamples Number of samples.
+ */
+STATIC_INLINE void BiquadFilterRun(BiquadFilter_t * filter, const float * input, float * output, const uint16_t numSamples) {
+    const float * in = input;
+    uint8_t stage;
+    for (stage = 0; stage < filter->numStages; ++stage) {
+        const BiquadCoefficients_t c = filter->coefficients[stage];
+        float s1 = filter->filter.buffer[2 * stage];
+        float s2 = filter->filter.buffer[2 * stage + 1];
+
+        uint16_t i;
+        for (i = 0; i < numSamples; ++i) {
+            float x = in[i];
+            float y = c.b0 * x + s1;
+            s1 = c.b1 * x - c.a1 * y + s2;
+            s2 = c.b2 * x - c.a2 * y;
+            output[i] = y;
+        }
+
+        filter->filter.buffer[2 * stage] = s1;
+        filter->filter.buffer[2 * stage + 1] = s2;
+
+        /* Later stages run in place on the output. */
+        in = output;
+    }
+
+    if (numSamples > 0) filter->output = output[numSamples - 1];
+}
+
+void BiquadFilterAddSample(BiquadFilter_t * filter, const float sample) {
+    BiquadFilterProcessBlock(filter, &sample, &filter->output, 1);
+}
+
+float BiquadFilterGetSample(const BiquadFilter_t * filter) {
+    return filter->output;
+}
+
+float BiquadFilterStep(BiquadFilter_t * filter, const float sample) {
+    BiquadFilterRun(filter, &sample, &filter->output, 1);
+    return filter->output;
+}
+
+void BiquadFilterProcessBlock(BiquadFilter_t * filter, const float * input, float * output, const uint16_t numSamples) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_BIQUAD);
+    assert(filter->mode == BIQUAD_FLOAT);
+
+    BiquadFilterRun(filter, input, output, numSamples);
+}
+
+/** @brief Saturates a Q60 accumulator to a Q31 sample. */
+static int32_t BiquadSaturateQ31(const int64_t acc) {
+    int64_t y = acc >> BIQUAD_COEFF_FRAC_BITS;
+    if (y > INT32_MAX) return INT32_MAX;
+    if (y < INT32_MIN) return INT32_MIN;
+    return (int32_t)y;
+}
+
+void BiquadFilterProcessBlockQ31(BiquadFilter_t * filter, const int32_t * input, int32_t * output, const uint16_t numSamples) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_BIQUAD);
+    assert(filter->mode == BIQUAD_FIXED);
+
+    const int32_t * in = input;
+    uint8_t stage;
+    for (stage = 0; stage < filter->numStages; ++stage) {
+        const BiquadFixedCoefficients_t c = filter->fixedCoefficients[stage];
+        int64_t s1 = filter->fixedState[2 * stage];
+        int64_t s2 = filter->fixedState[2 * stage + 1];
+
+        uint16_t i;
+        for (i = 0; i < numSamples; ++i) {
+            int32_t x = in[i];
+            int32_t y = BiquadSaturateQ31((int64_t)c.b0 * x + s1);
+            s1 = (int64_t)c.b1 * x - (int64_t)c.a1 * y + s2;
+            s2 = (int64_t)c.b2 * x - (int64_t)c.a2 * y;
+            output[i] = y;
+        }
+
+        filter->fixedState[2 * stage] = s1;
+        filter->fixedState[2 * stage + 1] = s2;
+        in = output;
+    }
+}
+
+void BiquadFilterProcessBlockQ15(BiquadFilter_t * filter, const int16_t * input, int16_t * output, const uint16_t numSamples) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_BIQUAD);
+    assert(filter->mode == BIQUAD_FIXED);
+
+    /* Run the Q31 kernel in chunks through a stack buffer. */
+    int32_t block[32];
+    uint16_t offset = 0;
+    while (offset < numSamples) {
+        uint16_t count = numSamples - offset < 32 ? numSamples - offset : 32;
+        uint16_t i;
+        for (i = 0; i < count; ++i) {
+            block[i] = (int32_t)input[offset + i] << 16;
+        }
+        BiquadFilterProcessBlockQ31(filter, block, block, count);
+        for (i = 0; i < count; ++i) {
+            int32_t y = (block[i] >> 16) + ((block[i] >> 15) & 1);
+            output[offset + i] = y > INT16_MAX ? INT16_MAX : y;
+        }
+        offset += count;
+    }
+}
+
+void BiquadFilterClear(BiquadFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_BIQUAD);
+
+    uint16_t i;
+    for (i = 0; i < 2 * filter->numStages; ++i) {
+        if (filter->mode == BIQUAD_FLOAT) filter->filter.buffer[i] = 0;
+        else filter->fixedState[i] = 0;
+    }
+    filter->output = 0;
+}
+
+/** @brief Converts a coefficient to Q2.29 with rounding. */
+static int32_t BiquadToFixed(const float value) {
+    assert(-4.0f <= value && value < 4.0f);
+    return (int32_t)lroundf(value * (float)(1UL << BIQUAD_COEFF_FRAC_BITS));
+}
+
+void BiquadCoefficientsToFixed(const BiquadCoefficients_t * coefficients, BiquadFixedCoefficients_t * fixedCoefficients, const uint8_t numStages) {
+    uint8_t i;
+    for (i = 0; i < numStages; ++i) {
+        fixedCoefficients[i].b0 = BiquadToFixed(coefficients[i].b0);
+        fixedCoefficients[i].b1 = BiquadToFixed(coefficients[i].b1);
+        fixedCoefficients[i].b2 = BiquadToFixed(coefficients[i].b2);
+        fixedCoefficients[i].a1 = BiquadToFixed(coefficients[i].a1);
+        fixedCoefficients[i].a2 = BiquadToFixed(coefficients[i].a2);
+    }
+}
+
+/**
+ * @brief BiquadNormalize divides every coefficient by a0.
+ *
+ * @param b0, b1, b2, a0, a1, a2 Unnormalized section coefficients.
+ * @return The normalized section.
+ */
+static BiquadCoefficients_t BiquadNormalize(float b0, float b1, float b2, float a0, float a1, float a2) {
+    BiquadCoefficients_t c = {
+        .b0=b0 / a0,
+        .b1=b1 / a0,
+        .b2=b2 / a0,
+        .a1=a1 / a0,
+        .a2=a2 / a0
+    };
+    return c;
+}
+
+BiquadCoefficients_t BiquadCoefficientsLowPass(const float cutoff, const float sampleRate, const float q) {
+    assert(0.0f < cutoff && cutoff < sampleRate / 2.0f && q > 0.0f);
+    float w0 = 2.0f * PI * cutoff / sampleRate;
+    float cosW0 = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    return BiquadNormalize(
+        (1.0f - cosW0) / 2.0f, 1.0f - cosW0, (1.0f - cosW0) / 2.0f,
+        1.0f + alpha, -2.0f * cosW0, 1.0f - alpha);
+}
+
+BiquadCoefficients_t BiquadCoefficientsHighPass(const float cutoff, const float sampleRate, const float q) {
+    assert(0.0f < cutoff && cutoff < sampleRate / 2.0f && q > 0.0f);
+    float w0 = 2.0f * PI * cutoff / sampleRate;
+    float cosW0 = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    return BiquadNormalize(
+        (1.0f + cosW0) / 2.0f, -(1.0f + cosW0), (1.0f + cosW0) / 2.0f,
+        1.0f + alpha, -2.0f * cosW0, 1.0f - alpha);
+}
+
+BiquadCoefficients_t BiquadCoefficientsBandPass(const float center, const float sampleRate, const float q) {
+    assert(0.0f < center && center < sampleRate / 2.0f && q > 0.0f);
+    float w0 = 2.0f * PI * center / sampleRate;
+    float cosW0 = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    return BiquadNormalize(
+        alpha, 0.0f, -alpha,
+        1.0f + alpha, -2.0f * cosW0, 1.0f - alpha);
+}
+
+BiquadCoefficients_t BiquadCoefficientsNotch(const float center, const float sampleRate, const float q) {
+    assert(0.0f < center && center < sampleRate / 2.0f && q > 0.0f);
+    float w0 = 2.0f * PI * center / sampleRate;
+    float cosW0 = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    return BiquadNormalize(
+        1.0f, -2.0f * cosW0, 1.0f,
+        1.0f + alpha, -2.0f * cosW0, 1.0f - alpha);
+}
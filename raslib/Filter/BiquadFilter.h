@@ -0,0 +1,225 @@
+/**
+ * @file BiquadFilter.h
+ * @author agent (agent@local)
+ * @brief Biquad IIR cascade filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note Coefficient design source: Robert Bristow-Johnson's Audio EQ Cookbook,
+ *       https://www.w3.org/TR/audio-eq-cookbook/
+ * @note
+ * A cascade of second order sections, each in Direct Form II Transposed:
+ *      y  = b0 * x + s1
+ *      s1 = b1 * x - a1 * y + s2
+ *      s2 = b2 * x - a2 * y
+ *
+ * Two modes are provided:
+ * - Float mode (BiquadFilterInit). State is kept in the FilterConfig_t
+ *   buffer, 2 floats per stage.
+ * - Fixed point mode (BiquadFilterFixedInit). Coefficients are Q2.29, which
+ *   covers the [-4, 4) range that second order sections need. State is kept in
+ *   a caller owned int64_t buffer, 2 entries per stage, in Q60. Samples are
+ *   processed as Q15 (int16_t) or Q31 (int32_t) blocks. Raw 12-bit ADC codes
+ *   can be fed to the Q15 path after a left shift by 3.
+ *
+ * The block functions run the whole block through one stage before moving to
+ * the next, so each stage's coefficients and state stay in registers. Input
+ * and output may be the same array.
+ */
+#pragma once
+
+/** Device Specific imports. */
+#include <raslib/Filter/Filter.h>
+
+
+/** @brief BiquadCoefficients_t holds one second order section, normalized so
+ *         that a0 is 1. */
+typedef struct BiquadCoefficients {
+    float b0;
+    float b1;
+    float b2;
+    float a1;
+    float a2;
+} BiquadCoefficients_t;
+
+/** @brief BiquadFixedCoefficients_t holds one second order section in Q2.29,
+ *         normalized so that a0 is 1. */
+typedef struct BiquadFixedCoefficients {
+    int32_t b0;
+    int32_t b1;
+    int32_t b2;
+    int32_t a1;
+    int32_t a2;
+} BiquadFixedCoefficients_t;
+
+/** @brief BiquadFilterMode is an enumeration specifying the arithmetic used by
+ *         the biquad filter. */
+enum BiquadFilterMode {
+    BIQUAD_FLOAT,
+    BIQUAD_FIXED
+};
+
+typedef struct BiquadFilter {
+    Filter_t filter;
+
+    enum BiquadFilterMode mode;
+
+    /** @brief Number of second order sections in the cascade. */
+    uint8_t numStages;
+
+    /** @brief Float mode only. numStages sections. */
+    const BiquadCoefficients_t * coefficients;
+
+    /** @brief Fixed mode only. numStages sections. */
+    const BiquadFixedCoefficients_t * fixedCoefficients;
+
+    /** @brief Fixed mode only. 2 * numStages state entries in Q60. */
+    int64_t * fixedState;
+
+    /** @brief Float mode only. The last output. */
+    float output;
+} BiquadFilter_t;
+
+/**
+ * @brief BiquadFilterInit initializes a float biquad cascade.
+ *
+ * @param config Filter configuration. The buffer must hold at least
+ *               2 * numStages floats.
+ * @param coefficients numStages second order sections. Must outlive the
+ *                     filter.
+ * @param numStages Number of sections, greater than zero.
+ * @return A BiquadFilter_t instance.
+ */
+BiquadFilter_t BiquadFilterInit(const FilterConfig_t config, const BiquadCoefficients_t * coefficients, const uint8_t numStages);
+
+/**
+ * @brief BiquadFilterFixedInit initializes a fixed point biquad cascade.
+ *
+ * @param config Filter configuration. Only the type is used.
+ * @param coefficients numStages Q2.29 second order sections. Must outlive the
+ *                     filter. See BiquadCoefficientsToFixed.
+ * @param numStages Number of sections, greater than zero.
+ * @param state A caller owned buffer of at least 2 * numStages entries.
+ * @return A BiquadFilter_t instance.
+ */
+BiquadFilter_t BiquadFilterFixedInit(const FilterConfig_t config, const BiquadFixedCoefficients_t * coefficients, const uint8_t numStages, int64_t * state);
+
+/**
+ * @brief BiquadFilterAddSample runs a single sample through a float cascade.
+ *
+ * @param filter Float mode biquad filter.
+ * @param sample Sample to add.
+ */
+void BiquadFilterAddSample(BiquadFilter_t * filter, const float sample);
+
+/**
+ * @brief BiquadFilterGetSample returns the last output of a float cascade.
+ *
+ * @param filter Float mode biquad filter.
+ * @return The last output.
+ */
+float BiquadFilterGetSample(const BiquadFilter_t * filter);
+
+/**
+ * @brief BiquadFilterStep adds a sample and returns the new output, like
+ *        BiquadFilterAddSample followed by BiquadFilterGetSample, but without
+ *        checking its arguments. It is meant for callers that validated the
+ *        filter once, such as a FilterPipeline_t.
+ *
+ * @param filter Float mode biquad filter.
+ * @param sample Sample to add.
+ * @return The new output.
+ */
+float BiquadFilterStep(BiquadFilter_t * filter, const float sample);
+
+/**
+ * @brief BiquadFilterProcessBlock runs a block of samples through a float
+ *        cascade.
+ *
+ * @param filter Float mode biquad filter.
+ * @param input Input samples.
+ * @param output Output samples. May be the same as input.
+ * @param numSamples Number of samples in the block.
+ */
+void BiquadFilterProcessBlock(BiquadFilter_t * filter, const float * input, float * output, const uint16_t numSamples);
+
+/**
+ * @brief BiquadFilterProcessBlockQ31 runs a block of Q31 samples through a
+ *        fixed point cascade. Outputs saturate.
+ *
+ * @param filter Fixed mode biquad filter.
+ * @param input Input samples.
+ * @param output Output samples. May be the same as input.
+ * @param numSamples Number of samples in the block.
+ */
+void BiquadFilterProcessBlockQ31(BiquadFilter_t * filter, const int32_t * input, int32_t * output, const uint16_t numSamples);
+
+/**
+ * @brief BiquadFilterProcessBlockQ15 runs a block of Q15 samples through a
+ *        fixed point cascade. Outputs are rounded and saturate.
+ *
+ * @param filter Fixed mode biquad filter.
+ * @param input Input samples.
+ * @param output Output samples. May be the same as input.
+ * @param numSamples Number of samples in the block.
+ */
+void BiquadFilterProcessBlockQ15(BiquadFilter_t * filter, const int16_t * input, int16_t * output, const uint16_t numSamples);
+
+/**
+ * @brief BiquadFilterClear zeroes the state of every stage.
+ *
+ * @param filter Biquad filter.
+ */
+void BiquadFilterClear(BiquadFilter_t * filter);
+
+/**
+ * @brief BiquadCoefficientsToFixed converts float sections to Q2.29.
+ *
+ * @param coefficients numStages float sections. Each coefficient must be in
+ *                     [-4, 4).
+ * @param fixedCoefficients Output, numStages fixed point sections.
+ * @param numStages Number of sections.
+ */
+void BiquadCoefficientsToFixed(const BiquadCoefficients_t * coefficients, BiquadFixedCoefficients_t * fixedCoefficients, const uint8_t numStages);
+
+/**
+ * @brief BiquadCoefficientsLowPass designs a second order low pass section.
+ *
+ * @param cutoff The -3 dB frequency, in hz. Must be below sampleRate / 2.
+ * @param sampleRate The sample rate, in hz.
+ * @param q The quality factor. 0.7071 gives a Butterworth response.
+ * @return The section coefficients.
+ */
+BiquadCoefficients_t BiquadCoefficientsLowPass(const float cutoff, const float sampleRate, const float q);
+
+/**
+ * @brief BiquadCoefficientsHighPass designs a second order high pass section.
+ *
+ * @param cutoff The -3 dB frequency, in hz. Must be below sampleRate / 2.
+ * @param sampleRate The sample rate, in hz.
+ * @param q The quality factor. 0.7071 gives a Butterworth response.
+ * @return The section coefficients.
+ */
+BiquadCoefficients_t BiquadCoefficientsHighPass(const float cutoff, const float sampleRate, const float q);
+
+/**
+ * @brief BiquadCoefficientsBandPass designs a second order band pass section
+ *        with 0 dB gain at the center frequency.
+ *
+ * @param center The center frequency, in hz. Must be below sampleRate / 2.
+ * @param sampleRate The sample rate, in hz.
+ * @param q The quality factor, center / bandwidth.
+ * @return The section coefficients.
+ */
+BiquadCoefficients_t BiquadCoefficientsBandPass(const float center, const float sampleRate, const float q);
+
+/**
+ * @brief BiquadCoefficientsNotch designs a second order notch section, such
+ *        as for rejecting motor PWM ripple.
+ *
+ * @param center The rejected frequency, in hz. Must be below sampleRate / 2.
+ * @param sampleRate The sample rate, in hz.
+ * @param q The quality factor, center / bandwidth.
+ * @return The section coefficients.
+ */
+BiquadCoefficients_t BiquadCoefficientsNotch(const float center, const float sampleRate, const float q);
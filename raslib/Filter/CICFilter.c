@@ -0,0 +1,196 @@
+/**
+ * @file CICFilter.c
+ * @author agent (agent@local)
+ * @brief Cascaded Integrator-Comb decimation filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ */
+
+/** General imports. */
+#include <assert.h>
+#include <stdlib.h>
+
+/** Device Specific imports. */
+#include <raslib/Filter/CICFilter.h>
+
+
+CICFilter_t CICFilterInit(const FilterConfig_t config, const uint8_t order, const uint16_t decimation) {
+    /* Initialization asserts. */
+    assert(config.type == FILTER_CIC);
+    assert(0 < order && order <= CIC_FILTER_MAX_ORDER);
+    assert(decimation > 1);
+
+    /* Compute the DC gain, checking that the output fits in 32 bits. */
+    uint32_t gain = 1;
+    uint8_t i;
+    for (i = 0; i < order; ++i) {
+        assert(gain * decimation <= (1UL << 20));
+        gain *= decimation;
+    }
+
+    uint8_t gainShift = 0;
+    if ((decimation & (decimation - 1)) == 0) {
+        while ((1UL << gainShift) < gain) ++gainShift;
+    }
+
+    Filter_t filter = {
+        .type=FILTER_CIC,
+        .buffer=config.buffer,
+        .bufferSize=config.bufferSize
+    };
+
+    CICFilter_t cicFilter = {
+        .filter=filter,
+        .order=order,
+        .decimation=decimation,
+        .phase=decimation,
+        .gain=gain,
+        .gainShift=gainShift,
+        .integrators={ 0 },
+        .combs={ 0 },
+        .output=0
+    };
+
+    return cicFilter;
+}
+
+/**
+ * @brief CICFilterNormalize divides a raw output by the DC gain.
+ *
+ * @param filter CIC filter.
+ * @param output Raw output.
+ * @return The output at the input scale.
+ */
+STATIC_INLINE uint16_t CICFilterNormalize(const CICFilter_t * filter, const uint32_t output) {
+    if (filter->gainShift > 0) return output >> filter->gainShift;
+    return output / filter->gain;
+}
+
+/**
+ * @brief CICFilterComb runs the comb stages on the last integrator output.
+ *
+ * @param filter CIC filter.
+ * @param value Output of the last integrator.
+ * @return The raw filter output.
+ */
+STATIC_INLINE uint32_t CICFilterComb(CICFilter_t * filter, uint32_t value) {
+    uint8_t stage;
+    for (stage = 0; stage < filter->order; ++stage) {
+        uint32_t previous = filter->combs[stage];
+        filter->combs[stage] = value;
+        value -= previous;
+    }
+    return value;
+}
+
+/**
+ * @brief CICFilterUpdate runs the integrators on a sample, and the combs when
+ *        a decimated output is due.
+ *
+ * @param filter CIC filter.
+ * @param sample Sample to add.
+ * @return True if a new output was computed.
+ */
+STATIC_INLINE bool CICFilterUpdate(CICFilter_t * filter, const uint16_t sample) {
+    uint32_t value = sample;
+    uint8_t stage;
+    for (stage = 0; stage < filter->order; ++stage) {
+        filter->integrators[stage] += value;
+        value = filter->integrators[stage];
+    }
+
+    if (--filter->phase > 0) return false;
+    filter->phase = filter->decimation;
+    filter->output = CICFilterComb(filter, value);
+    return true;
+}
+
+bool CICFilterAddIntSample(CICFilter_t * filter, const uint16_t sample) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_CIC);
+
+    return CICFilterUpdate(filter, sample);
+}
+
+float CICFilterStep(CICFilter_t * filter, const uint16_t sample) {
+    CICFilterUpdate(filter, sample);
+    return (float)filter->output / filter->gain;
+}
+
+uint16_t CICFilterAddIntSamples(CICFilter_t * filter, const uint16_t * samples, const uint16_t numSamples, uint16_t * output) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_CIC);
+    assert(samples != NULL);
+
+    /* Keep the filter state in locals for the duration of the burst. */
+    const uint8_t order = filter->order;
+    uint32_t integrators[CIC_FILTER_MAX_ORDER];
+    uint16_t phase = filter->phase;
+    uint16_t numOutputs = 0;
+    uint8_t stage;
+    for (stage = 0; stage < order; ++stage) {
+        integrators[stage] = filter->integrators[stage];
+    }
+
+    uint16_t i;
+    for (i = 0; i < numSamples; ++i) {
+        /* Integrators, at the input rate. */
+        uint32_t value = samples[i];
+        for (stage = 0; stage < order; ++stage) {
+            integrators[stage] += value;
+            value = integrators[stage];
+        }
+
+        if (--phase > 0) continue;
+        phase = filter->decimation;
+
+        /* Combs, at the output rate. */
+        value = CICFilterComb(filter, value);
+
+        filter->output = value;
+        if (output != NULL) {
+            output[numOutputs] = CICFilterNormalize(filter, value);
+        }
+        ++numOutputs;
+    }
+
+    for (stage = 0; stage < order; ++stage) {
+        filter->integrators[stage] = integrators[stage];
+    }
+    filter->phase = phase;
+
+    return numOutputs;
+}
+
+float CICFilterGetSample(const CICFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_CIC);
+
+    return (float)filter->output / filter->gain;
+}
+
+uint16_t CICFilterGetIntSample(const CICFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_CIC);
+
+    return CICFilterNormalize(filter, filter->output);
+}
+
+void CICFilterClear(CICFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_CIC);
+
+    uint8_t stage;
+    for (stage = 0; stage < CIC_FILTER_MAX_ORDER; ++stage) {
+        filter->integrators[stage] = 0;
+        filter->combs[stage] = 0;
+    }
+    filter->phase = filter->decimation;
+    filter->output = 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file CICFilter.h
+ * @author agent (agent@local)
+ * @brief Cascaded Integrator-Comb decimation filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note Source: E. Hogenauer, An Economical Class of Digital Filters for
+ *       Decimation and Interpolation, IEEE Trans. ASSP, 1981.
+ * @note
+ * A CIC decimator of order N and decimation factor R is N integrators running
+ * at the input rate, a downsample by R, and N combs (y = x - x[-1]) running at
+ * the output rate. Its response is that of N cascaded R sample boxcars, with
+ * nulls at every multiple of the output rate, and it needs no multiplies.
+ *
+ * Integrators wrap around. This is harmless as long as the full scale output,
+ * 4095 * R^N for 12-bit ADC codes, fits in 32 bits, so R^N must be at most
+ * 2^20. The DC gain R^N is divided out on read: by a shift if R is a power of
+ * two, otherwise by a divide at the output rate.
+ *
+ * The filter does not use a sample buffer; config.buffer may be NULL.
+ */
+#pragma once
+
+/** Device Specific imports. */
+#include <raslib/Filter/Filter.h>
+
+
+/** @brief Maximum order of a CIC filter. */
+#define CIC_FILTER_MAX_ORDER 5
+
+typedef struct CICFilter {
+    Filter_t filter;
+
+    /** @brief Number of integrator and comb stages. */
+    uint8_t order;
+
+    /** @brief Number of input samples per output. */
+    uint16_t decimation;
+
+    /** @brief Input samples remaining until the next output. */
+    uint16_t phase;
+
+    /** @brief DC gain, decimation^order. */
+    uint32_t gain;
+
+    /** @brief log2(gain) if the decimation is a power of two, otherwise 0. */
+    uint8_t gainShift;
+
+    uint32_t integrators[CIC_FILTER_MAX_ORDER];
+
+    /** @brief Previous input of each comb stage. */
+    uint32_t combs[CIC_FILTER_MAX_ORDER];
+
+    /** @brief The last output, not yet divided by the gain. */
+    uint32_t output;
+} CICFilter_t;
+
+/**
+ * @brief CICFilterInit initializes a CIC decimation filter.
+ *
+ * @param config Filter configuration. Only the type is used.
+ * @param order Number of stages, from [1, CIC_FILTER_MAX_ORDER].
+ * @param decimation Decimation factor R, greater than one. decimation^order
+ *                   must be at most 2^20.
+ * @return A CICFilter_t instance.
+ */
+CICFilter_t CICFilterInit(const FilterConfig_t config, const uint8_t order, const uint16_t decimation);
+
+/**
+ * @brief CICFilterAddIntSample adds a raw ADC code to the filter.
+ *
+ * @param filter CIC filter.
+ * @param sample Sample to add, from [0, 4095].
+ * @return True if a new output was computed.
+ */
+bool CICFilterAddIntSample(CICFilter_t * filter, const uint16_t sample);
+
+/**
+ * @brief CICFilterAddIntSamples adds a burst of raw ADC codes to the filter.
+ *
+ * @param filter CIC filter.
+ * @param samples Samples to add, from [0, 4095].
+ * @param numSamples Number of samples in the burst.
+ * @param output Outputs, normalized to the input scale. Must hold
+ *               numSamples / decimation + 1 entries. May be NULL if only the
+ *               last output is read through CICFilterGetIntSample.
+ * @return The number of outputs computed.
+ */
+uint16_t CICFilterAddIntSamples(CICFilter_t * filter, const uint16_t * samples, const uint16_t numSamples, uint16_t * output);
+
+/**
+ * @brief CICFilterGetSample returns the last output normalized to the input
+ *        scale, including the fractional part.
+ *
+ * @param filter CIC filter.
+ * @return The last output.
+ */
+float CICFilterGetSample(const CICFilter_t * filter);
+
+/**
+ * @brief CICFilterStep adds a sample and returns the new output, like
+ *        CICFilterAddIntSample followed by CICFilterGetSample, but without
+ *        checking its arguments. It is meant for callers that validated the
+ *        filter once, such as a FilterPipeline_t. Between decimated samples,
+ *        it returns the last output.
+ *
+ * @param filter CIC filter.
+ * @param sample Sample to add, from [0, 4095].
+ * @return The new output.
+ */
+float CICFilterStep(CICFilter_t * filter, const uint16_t sample);
+
+/**
+ * @brief CICFilterGetIntSample returns the last output normalized to the
+ *        input scale, truncated to an integer.
+ *
+ * @param filter CIC filter.
+ * @return The last output.
+ */
+uint16_t CICFilterGetIntSample(const CICFilter_t * filter);
+
+/**
+ * @brief CICFilterClear zeroes the integrators and combs and resets the
+ *        decimation phase.
+ *
+ * @param filter CIC filter.
+ */
+void CICFilterClear(CICFilter_t * filter);
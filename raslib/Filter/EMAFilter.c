@@ -0,0 +1,134 @@
+/**
+ * @file EMAFilter.c
+ * @author agent (agent@local)
+ * @brief Exponential Moving Average filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ */
+
+/** General imports. */
+#include <assert.h>
+#include <stdlib.h>
+
+/** Device Specific imports. */
+#include <raslib/Filter/EMAFilter.h>
+
+
+EMAFilter_t EMAFilterInit(const FilterConfig_t config, const float alpha) {
+    /* Initialization asserts. */
+    assert(config.type == FILTER_EMA);
+    assert(0.0 < alpha && alpha <= 1.0);
+
+    Filter_t filter = {
+        .type=FILTER_EMA,
+        .buffer=config.buffer,
+        .bufferSize=config.bufferSize
+    };
+
+    EMAFilter_t emaFilter = {
+        .filter=filter,
+        .mode=EMA_FLOAT,
+        .alpha=alpha,
+        .estimate=0,
+        .shift=0,
+        .accumulator=0,
+        .isSeeded=false
+    };
+
+    return emaFilter;
+}
+
+EMAFilter_t EMAFilterIntInit(const FilterConfig_t config, const uint8_t shift) {
+    /* Initialization asserts. */
+    assert(config.type == FILTER_EMA);
+    assert(shift <= 16);
+
+    Filter_t filter = {
+        .type=FILTER_EMA,
+        .buffer=config.buffer,
+        .bufferSize=config.bufferSize
+    };
+
+    EMAFilter_t emaFilter = {
+        .filter=filter,
+        .mode=EMA_INT,
+        .alpha=1.0f / (1UL << shift),
+        .estimate=0,
+        .shift=shift,
+        .accumulator=0,
+        .isSeeded=false
+    };
+
+    return emaFilter;
+}
+
+float EMAFilterStep(EMAFilter_t * filter, const float sample) {
+    /* Seed with the first sample instead of ramping up from zero. */
+    if (!filter->isSeeded) {
+        filter->estimate = sample;
+        filter->isSeeded = true;
+        return sample;
+    }
+
+    filter->estimate += filter->alpha * (sample - filter->estimate);
+    return filter->estimate;
+}
+
+void EMAFilterAddSample(EMAFilter_t * filter, const float sample) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_EMA);
+    assert(filter->mode == EMA_FLOAT);
+
+    EMAFilterStep(filter, sample);
+}
+
+void EMAFilterAddIntSample(EMAFilter_t * filter, const uint16_t sample) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_EMA);
+    assert(filter->mode == EMA_INT);
+    assert(sample <= 4095);
+
+    if (!filter->isSeeded) {
+        filter->accumulator = (uint32_t)sample << filter->shift;
+        filter->isSeeded = true;
+        return;
+    }
+
+    /* acc/2^k += (sample - acc/2^k)/2^k, multiplied through by 2^k. */
+    filter->accumulator += sample - (filter->accumulator >> filter->shift);
+}
+
+float EMAFilterGetSample(const EMAFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_EMA);
+
+    if (filter->mode == EMA_INT) {
+        return (float)filter->accumulator / (1UL << filter->shift);
+    }
+    return filter->estimate;
+}
+
+uint16_t EMAFilterGetIntSample(const EMAFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_EMA);
+
+    if (filter->mode == EMA_INT) {
+        return filter->accumulator >> filter->shift;
+    }
+    return (uint16_t)filter->estimate;
+}
+
+void EMAFilterClear(EMAFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_EMA);
+
+    filter->estimate = 0;
+    filter->accumulator = 0;
+    filter->isSeeded = false;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file EMAFilter.h
+ * @author agent (agent@local)
+ * @brief Exponential Moving Average filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note
+ * The EMA filter computes estimate = estimate + alpha * (sample - estimate).
+ * It does not use a sample buffer; config.buffer may be NULL.
+ *
+ * Two modes are provided:
+ * - Float mode (EMAFilterInit). Any alpha in (0, 1].
+ * - Integer mode (EMAFilterIntInit). alpha = 1/2^shift. The filter keeps
+ *   the estimate scaled by 2^shift in an integer accumulator, so each sample
+ *   costs a shift, a subtract and an add. Meant for raw 12-bit ADC codes
+ *   inside interrupts.
+ */
+#pragma once
+
+/** Device Specific imports. */
+#include <raslib/Filter/Filter.h>
+
+
+/** @brief EMAFilterMode is an enumeration specifying the arithmetic used by
+ *         the EMA filter. */
+enum EMAFilterMode {
+    EMA_FLOAT,
+    EMA_INT
+};
+
+typedef struct EMAFilter {
+    Filter_t filter;
+
+    enum EMAFilterMode mode;
+
+    /** @brief Float mode only. The smoothing factor, from (0, 1]. */
+    float alpha;
+
+    /** @brief Float mode only. The current estimate. */
+    float estimate;
+
+    /** @brief Integer mode only. alpha is 1/2^shift. */
+    uint8_t shift;
+
+    /** @brief Integer mode only. The current estimate scaled by 2^shift. */
+    uint32_t accumulator;
+
+    /** @brief Whether the filter has been seeded with its first sample. */
+    bool isSeeded;
+} EMAFilter_t;
+
+/**
+ * @brief EMAFilterInit initializes a float mode EMA filter.
+ *
+ * @param config Filter configuration. Only the type is used.
+ * @param alpha Smoothing factor, from (0, 1]. Higher values track the input
+ *              faster.
+ * @return An EMAFilter_t instance.
+ */
+EMAFilter_t EMAFilterInit(const FilterConfig_t config, const float alpha);
+
+/**
+ * @brief EMAFilterIntInit initializes an integer mode EMA filter, where
+ *        alpha = 1/2^shift.
+ *
+ * @param config Filter configuration. Only the type is used.
+ * @param shift Smoothing shift, from [0, 16]. A shift of 0 passes samples
+ *              through unfiltered.
+ * @return An EMAFilter_t instance.
+ */
+EMAFilter_t EMAFilterIntInit(const FilterConfig_t config, const uint8_t shift);
+
+/**
+ * @brief EMAFilterAddSample adds a sample to a float mode EMA filter.
+ *
+ * @param filter Float mode EMA filter.
+ * @param sample Sample to add.
+ */
+void EMAFilterAddSample(EMAFilter_t * filter, const float sample);
+
+/**
+ * @brief EMAFilterAddIntSample adds a raw ADC code to an integer mode EMA
+ *        filter.
+ *
+ * @param filter Integer mode EMA filter.
+ * @param sample Sample to add, from [0, 4095].
+ */
+void EMAFilterAddIntSample(EMAFilter_t * filter, const uint16_t sample);
+
+/**
+ * @brief EMAFilterGetSample returns the current estimate. In integer mode,
+ *        this includes the fractional bits kept in the accumulator.
+ *
+ * @param filter EMA filter.
+ * @return The current estimate.
+ */
+float EMAFilterGetSample(const EMAFilter_t * filter);
+
+/**
+ * @brief EMAFilterStep adds a sample and returns the new output, like
+ *        EMAFilterAddSample followed by EMAFilterGetSample, but without
+ *        checking its arguments. It is meant for callers that validated the
+ *        filter once, such as a FilterPipeline_t.
+ *
+ * @param filter Float mode EMA filter.
+ * @param sample Sample to add.
+ * @return The new output.
+ */
+float EMAFilterStep(EMAFilter_t * filter, const float sample);
+
+/**
+ * @brief EMAFilterGetIntSample returns the current estimate truncated to an
+ *        integer.
+ *
+ * @param filter EMA filter.
+ * @return The current estimate.
+ */
+uint16_t EMAFilterGetIntSample(const EMAFilter_t * filter);
+
+void EMAFilterClear(EMAFilter_t * filter);
@@ -0,0 +1,165 @@
+/**
+ * @file FIRFilter.c
+ * @author agent (agent@local)
+ * @brief Finite Impulse Response filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ */
+
+/** General imports. */
+#include <assert.h>
+#include <stdlib.h>
+
+/** Device Specific imports. */
+#include <raslib/Filter/FIRFilter.h>
+
+
+FIRFilter_t FIRFilterInit(const FilterConfig_t config, const float * taps, const uint16_t numTaps) {
+    return FIRFilterDecimateInit(config, taps, numTaps, 1);
+}
+
+FIRFilter_t FIRFilterDecimateInit(const FilterConfig_t config, const float * taps, const uint16_t numTaps, const uint16_t decimation) {
+    /* Initialization asserts. */
+    assert(config.type == FILTER_FIR);
+    assert(config.buffer != NULL);
+    assert(taps != NULL);
+    assert(numTaps > 0);
+    assert(config.bufferSize >= 2 * (uint32_t)numTaps);
+    assert(decimation > 0);
+
+    Filter_t filter = {
+        .type=config.type,
+        .buffer=config.buffer,
+        .bufferSize=config.bufferSize
+    };
+
+    FIRFilter_t firFilter = {
+        .filter=filter,
+        .taps=taps,
+        .numTaps=numTaps,
+        .curIdx=0,
+        .decimation=decimation,
+        .phase=decimation,
+        .output=0
+    };
+    FIRFilterClear(&firFilter);
+
+    return firFilter;
+}
+
+/**
+ * @brief FIRFilterPush writes a sample into both halves of the mirrored
+ *        buffer.
+ *
+ * @param history Mirrored buffer.
+ * @param numTaps Number of coefficients.
+ * @param curIdx Start of the newest samples. Updated.
+ * @param sample Sample to add.
+ */
+STATIC_INLINE void FIRFilterPush(float * history, const uint16_t numTaps, uint16_t * curIdx, const float sample) {
+    uint16_t idx = *curIdx == 0 ? numTaps - 1 : *curIdx - 1;
+    history[idx] = sample;
+    history[idx + numTaps] = sample;
+    *curIdx = idx;
+}
+
+/**
+ * @brief FIRFilterConvolve computes the dot product of the taps against the
+ *        newest numTaps samples.
+ *
+ * @param history Start of the newest samples in the mirrored buffer.
+ * @param taps Coefficients.
+ * @param numTaps Number of coefficients.
+ * @return The filter output.
+ */
+STATIC_INLINE float FIRFilterConvolve(const float * history, const float * taps, const uint16_t numTaps) {
+    /* Two accumulators so consecutive multiply-adds do not wait on each
+       other. */
+    float acc0 = 0;
+    float acc1 = 0;
+    uint16_t i;
+    for (i = 0; i + 1 < numTaps; i += 2) {
+        acc0 += taps[i] * history[i];
+        acc1 += taps[i + 1] * history[i + 1];
+    }
+    if (i < numTaps) acc0 += taps[i] * history[i];
+    return acc0 + acc1;
+}
+
+float FIRFilterStep(FIRFilter_t * filter, const float sample) {
+    FIRFilterPush(filter->filter.buffer, filter->numTaps, &filter->curIdx, sample);
+
+    if (--filter->phase > 0) return filter->output;
+    filter->phase = filter->decimation;
+    filter->output = FIRFilterConvolve(
+        &filter->filter.buffer[filter->curIdx],
+        filter->taps,
+        filter->numTaps);
+    return filter->output;
+}
+
+bool FIRFilterAddSample(FIRFilter_t * filter, const float sample) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_FIR);
+    assert(filter->curIdx < filter->numTaps);
+
+    FIRFilterStep(filter, sample);
+
+    /* The phase is reloaded only when an output is computed. */
+    return filter->phase == filter->decimation;
+}
+
+float FIRFilterGetSample(const FIRFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_FIR);
+
+    return filter->output;
+}
+
+uint16_t FIRFilterProcessBlock(FIRFilter_t * filter, const float * input, float * output, const uint16_t numSamples) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_FIR);
+    assert(input != NULL);
+    assert(output != NULL);
+
+    /* Keep the filter state in locals for the duration of the block. */
+    float * history = filter->filter.buffer;
+    const float * taps = filter->taps;
+    const uint16_t numTaps = filter->numTaps;
+    const uint16_t decimation = filter->decimation;
+    uint16_t curIdx = filter->curIdx;
+    uint16_t phase = filter->phase;
+    uint16_t numOutputs = 0;
+
+    uint16_t i;
+    for (i = 0; i < numSamples; ++i) {
+        FIRFilterPush(history, numTaps, &curIdx, input[i]);
+        if (--phase > 0) continue;
+        phase = decimation;
+        output[numOutputs++] = FIRFilterConvolve(&history[curIdx], taps, numTaps);
+    }
+
+    filter->curIdx = curIdx;
+    filter->phase = phase;
+    if (numOutputs > 0) filter->output = output[numOutputs - 1];
+
+    return numOutputs;
+}
+
+void FIRFilterClear(FIRFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_FIR);
+
+    uint16_t i;
+    for (i = 0; i < 2 * filter->numTaps; ++i) {
+        filter->filter.buffer[i] = 0;
+    }
+    filter->curIdx = 0;
+    filter->phase = filter->decimation;
+    filter->output = 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file FIRFilter.h
+ * @author agent (agent@local)
+ * @brief Finite Impulse Response filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note
+ * The history is stored twice, back to back, in a mirrored buffer of
+ * 2 * numTaps floats. Every sample is written at curIdx and at
+ * curIdx + numTaps, so the last numTaps samples are always contiguous at
+ * buffer[curIdx, curIdx + numTaps), newest first. The convolution is then a
+ * straight dot product against the taps with no modulo or wraparound branch.
+ *
+ * The decimating mode (FIRFilterDecimateInit) still records every sample but
+ * only computes the dot product on every Mth one.
+ */
+#pragma once
+
+/** Device Specific imports. */
+#include <raslib/Filter/Filter.h>
+
+
+typedef struct FIRFilter {
+    Filter_t filter;
+
+    /** @brief numTaps coefficients. taps[0] weighs the newest sample. */
+    const float * taps;
+
+    uint16_t numTaps;
+
+    /** @brief Start of the newest numTaps samples in the mirrored buffer. */
+    uint16_t curIdx;
+
+    /** @brief Decimation factor. 1 computes every output. */
+    uint16_t decimation;
+
+    /** @brief Samples remaining until the next output is computed. */
+    uint16_t phase;
+
+    /** @brief The last output. */
+    float output;
+} FIRFilter_t;
+
+/**
+ * @brief FIRFilterInit initializes a FIR filter that computes an output for
+ *        every input sample.
+ *
+ * @param config Filter configuration. The buffer must hold at least
+ *               2 * numTaps floats.
+ * @param taps numTaps coefficients. Must outlive the filter.
+ * @param numTaps Number of coefficients, greater than zero.
+ * @return A FIRFilter_t instance.
+ */
+FIRFilter_t FIRFilterInit(const FilterConfig_t config, const float * taps, const uint16_t numTaps);
+
+/**
+ * @brief FIRFilterDecimateInit initializes a FIR filter that computes an
+ *        output for every Mth input sample.
+ *
+ * @param config Filter configuration. The buffer must hold at least
+ *               2 * numTaps floats.
+ * @param taps numTaps coefficients. Must outlive the filter.
+ * @param numTaps Number of coefficients, greater than zero.
+ * @param decimation Decimation factor M, greater than zero.
+ * @return A FIRFilter_t instance.
+ */
+FIRFilter_t FIRFilterDecimateInit(const FilterConfig_t config, const float * taps, const uint16_t numTaps, const uint16_t decimation);
+
+/**
+ * @brief FIRFilterAddSample adds a sample to the filter.
+ *
+ * @param filter FIR filter.
+ * @param sample Sample to add.
+ * @return True if a new output was computed. Always true when the decimation
+ *         factor is 1.
+ */
+bool FIRFilterAddSample(FIRFilter_t * filter, const float sample);
+
+/**
+ * @brief FIRFilterGetSample returns the last computed output.
+ *
+ * @param filter FIR filter.
+ * @return The last output.
+ */
+float FIRFilterGetSample(const FIRFilter_t * filter);
+
+/**
+ * @brief FIRFilterStep adds a sample and returns the new output, like
+ *        FIRFilterAddSample followed by FIRFilterGetSample, but without
+ *        checking its arguments. It is meant for callers that validated the
+ *        filter once, such as a FilterPipeline_t. Between
+ *        decimated samples, it returns the last output.
+ *
+ * @param filter FIR filter.
+ * @param sample Sample to add.
+ * @return The new output.
+ */
+float FIRFilterStep(FIRFilter_t * filter, const float sample);
+
+/**
+ * @brief FIRFilterProcessBlock adds a block of samples to the filter.
+ *
+ * @param filter FIR filter.
+ * @param input Input samples.
+ * @param output Output samples. Must hold numSamples / decimation + 1 entries,
+ *               or numSamples entries when the decimation factor is 1. May be
+ *               the same as input.
+ * @param numSamples Number of samples in the block.
+ * @return The number of outputs written.
+ */
+uint16_t FIRFilterProcessBlock(FIRFilter_t * filter, const float * input, float * output, const uint16_t numSamples);
+
+/**
+ * @brief FIRFilterClear zeroes the history and resets the decimation phase.
+ *
+ * @param filter FIR filter.
+ */
+void FIRFilterClear(FIRFilter_t * filter);
@@ -12,11 +12,19 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+/** Device specific imports. */
+#include <inc/Inline.h>
+
 enum FilterType {
     FILTER_MEDIAN,
     FILTER_EMA,
     FILTER_SMA,
     FILTER_KALMAN,
+    FILTER_BIQUAD,
+    FILTER_FIR,
+    FILTER_CIC,
+    FILTER_HAMPEL,
+    FILTER_KALMAN_VECTOR,
     NUM_FILTERS
 };
 
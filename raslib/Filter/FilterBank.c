@@ -0,0 +1,125 @@
+/**
+ * @file FilterBank.c
+ * @author agent (agent@local)
+ * @brief Multichannel filter bank for ADC sequencer sample vectors.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ */
+
+/** General imports. */
+#include <assert.h>
+#include <stdlib.h>
+
+/** Device Specific imports. */
+#include <raslib/Filter/FilterBank.h>
+
+
+FilterBank_t FilterBankInit(const FilterBankConfig_t config) {
+    /* Initialization asserts. */
+    assert(config.type == FILTER_SMA || config.type == FILTER_EMA);
+    assert(0 < config.numChannels && config.numChannels <= FILTER_BANK_MAX_CHANNELS);
+    if (config.type == FILTER_SMA) {
+        assert(config.history != NULL);
+        assert(config.windowSize > 0);
+    } else {
+        assert(config.shift <= 16);
+    }
+
+    FilterBank_t bank = {
+        .type=config.type,
+        .numChannels=config.numChannels,
+        .history=config.history,
+        .windowSize=config.windowSize,
+        .shift=config.shift,
+        .curIdx=0,
+        .numSamples=0,
+        .accumulators={0}
+    };
+    FilterBankClear(&bank);
+
+    return bank;
+}
+
+void FilterBankAddSamples(FilterBank_t * bank, const uint16_t samples[FILTER_BANK_MAX_CHANNELS]) {
+    /* Initialization asserts. */
+    assert(bank != NULL);
+    assert(samples != NULL);
+
+    uint8_t i;
+    uint8_t numChannels = bank->numChannels;
+    uint32_t * acc = bank->accumulators;
+
+    if (bank->type == FILTER_SMA) {
+        /* The history is zeroed on init, so the oldest vector can always be
+           subtracted, even while the window is filling. */
+        uint16_t * row = bank->history + bank->curIdx * numChannels;
+        for (i = 0; i < numChannels; ++i) {
+            acc[i] += samples[i] - row[i];
+            row[i] = samples[i];
+        }
+
+        bank->numSamples += bank->numSamples < bank->windowSize;
+        if (++bank->curIdx == bank->windowSize) bank->curIdx = 0;
+    } else {
+        uint8_t shift = bank->shift;
+        if (bank->numSamples == 0) {
+            /* Seed with the first vector instead of ramping up from zero. */
+            for (i = 0; i < numChannels; ++i) {
+                acc[i] = (uint32_t)samples[i] << shift;
+            }
+            bank->numSamples = 1;
+            return;
+        }
+        for (i = 0; i < numChannels; ++i) {
+            acc[i] += samples[i] - (acc[i] >> shift);
+        }
+    }
+}
+
+void FilterBankGetSamples(const FilterBank_t * bank, uint16_t outputs[FILTER_BANK_MAX_CHANNELS]) {
+    /* Initialization asserts. */
+    assert(bank != NULL);
+    assert(outputs != NULL);
+
+    uint8_t i;
+    if (bank->type == FILTER_SMA) {
+        uint16_t numSamples = bank->numSamples ? bank->numSamples : 1;
+        for (i = 0; i < bank->numChannels; ++i) {
+            outputs[i] = bank->accumulators[i] / numSamples;
+        }
+    } else {
+        for (i = 0; i < bank->numChannels; ++i) {
+            outputs[i] = bank->accumulators[i] >> bank->shift;
+        }
+    }
+}
+
+uint16_t FilterBankGetSample(const FilterBank_t * bank, const uint8_t channel) {
+    /* Initialization asserts. */
+    assert(bank != NULL);
+    assert(channel < bank->numChannels);
+
+    if (bank->type == FILTER_SMA) {
+        if (bank->numSamples == 0) return 0;
+        return bank->accumulators[channel] / bank->numSamples;
+    }
+    return bank->accumulators[channel] >> bank->shift;
+}
+
+void FilterBankClear(FilterBank_t * bank) {
+    /* Initialization asserts. */
+    assert(bank != NULL);
+
+    uint32_t i;
+    bank->curIdx = 0;
+    bank->numSamples = 0;
+    for (i = 0; i < FILTER_BANK_MAX_CHANNELS; ++i) {
+        bank->accumulators[i] = 0;
+    }
+    if (bank->type == FILTER_SMA) {
+        for (i = 0; i < (uint32_t)bank->windowSize * bank->numChannels; ++i) {
+            bank->history[i] = 0;
+        }
+    }
+}
@@ -0,0 +1,134 @@
+/**
+ * @file FilterBank.h
+ * @author agent (agent@local)
+ * @brief Multichannel filter bank for ADC sequencer sample vectors.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note
+ * A filter bank filters up to FILTER_BANK_MAX_CHANNELS channels at once, such
+ * as the uint16_t arr[8] vector filled by ADCSampleSequencer or the values
+ * array of a LineSensor_t. State is stored as a structure of arrays: the
+ * channels share one ring index and sample count, and each update is a single
+ * branch free loop over the channels.
+ *
+ * Supported filter types:
+ * - FILTER_SMA. Simple moving average over windowSize vectors. Requires a
+ *   caller owned history buffer of windowSize * numChannels entries.
+ * - FILTER_EMA. Integer exponential moving average with alpha = 1/2^shift.
+ *   Requires no buffer.
+ */
+#pragma once
+
+/** Device Specific imports. */
+#include <raslib/Filter/Filter.h>
+
+
+/** @brief Maximum number of channels in a filter bank. Matches the depth of
+ *         ADC sample sequencer 0. */
+#define FILTER_BANK_MAX_CHANNELS 8
+
+/**
+ * @brief FilterBankConfig_t is a user defined struct that specifies a filter
+ *        bank configuration.
+ */
+typedef struct FilterBankConfig {
+    /**
+     * @brief The filter applied to every channel. Either FILTER_SMA or
+     *        FILTER_EMA.
+     */
+    enum FilterType type;
+
+    /**
+     * @brief The number of channels in each sample vector, from
+     *        [1, FILTER_BANK_MAX_CHANNELS].
+     */
+    uint8_t numChannels;
+
+    /** ------------- Optional Fields. ------------- */
+
+    /**
+     * @brief FILTER_SMA only. Caller owned history buffer of at least
+     *        windowSize * numChannels entries. Sample vector i of the window is
+     *        stored at history[i * numChannels].
+     *
+     * Default is NULL.
+     */
+    uint16_t * history;
+
+    /**
+     * @brief FILTER_SMA only. The number of vectors averaged.
+     *
+     * Default is 0.
+     */
+    uint16_t windowSize;
+
+    /**
+     * @brief FILTER_EMA only. alpha is 1/2^shift, from [0, 16].
+     *
+     * Default is 0 (no filtering).
+     */
+    uint8_t shift;
+} FilterBankConfig_t;
+
+/** @brief FilterBank_t is a struct containing the state of a filter bank. */
+typedef struct FilterBank {
+    enum FilterType type;
+
+    uint8_t numChannels;
+
+    uint16_t * history;
+
+    uint16_t windowSize;
+
+    uint8_t shift;
+
+    /** @brief Ring index into the history buffer shared by all channels. */
+    uint16_t curIdx;
+
+    /** @brief Number of vectors added, saturating at windowSize. */
+    uint16_t numSamples;
+
+    /**
+     * @brief Per channel state. For FILTER_SMA, the exact running sum of the
+     *        window. For FILTER_EMA, the estimate scaled by 2^shift.
+     */
+    uint32_t accumulators[FILTER_BANK_MAX_CHANNELS];
+} FilterBank_t;
+
+/**
+ * @brief FilterBankInit initializes a filter bank. The history buffer, if
+ *        any, is zeroed.
+ *
+ * @param config Filter bank configuration.
+ * @return A FilterBank_t instance.
+ */
+FilterBank_t FilterBankInit(const FilterBankConfig_t config);
+
+/**
+ * @brief FilterBankAddSamples adds one sample to every channel.
+ *
+ * @param bank Filter bank.
+ * @param samples Sample vector of at least numChannels entries, such as the
+ *                array filled by ADCSampleSequencer.
+ */
+void FilterBankAddSamples(FilterBank_t * bank, const uint16_t samples[FILTER_BANK_MAX_CHANNELS]);
+
+/**
+ * @brief FilterBankGetSamples writes the filtered output of every channel.
+ *
+ * @param bank Filter bank.
+ * @param outputs Output vector of at least numChannels entries.
+ */
+void FilterBankGetSamples(const FilterBank_t * bank, uint16_t outputs[FILTER_BANK_MAX_CHANNELS]);
+
+/**
+ * @brief FilterBankGetSample returns the filtered output of a single channel.
+ *
+ * @param bank Filter bank.
+ * @param channel Channel index, less than numChannels.
+ * @return The filtered output.
+ */
+uint16_t FilterBankGetSample(const FilterBank_t * bank, const uint8_t channel);
+
+void FilterBankClear(FilterBank_t * bank);
@@ -0,0 +1,229 @@
+/**
+ * @file FilterPipeline.c
+ * @author agent (agent@local)
+ * @brief Chains heterogeneous filters into a single filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ */
+
+/** General imports. */
+#include <assert.h>
+#include <stdlib.h>
+
+/** Device Specific imports. */
+#include <raslib/Filter/FilterPipeline.h>
+#include <raslib/Filter/MedianFilter.h>
+#include <raslib/Filter/EMAFilter.h>
+#include <raslib/Filter/SMAFilter.h>
+#include <raslib/Filter/KalmanFilter.h>
+#include <raslib/Filter/KalmanVectorFilter.h>
+#include <raslib/Filter/BiquadFilter.h>
+#include <raslib/Filter/FIRFilter.h>
+#include <raslib/Filter/CICFilter.h>
+#include <raslib/Filter/HampelFilter.h>
+
+
+/**
+ * Stage adapters. Each adds a sample and returns the new output. Filters are
+ * validated once, in FilterPipelineInit, so the adapters call the unchecked
+ * step functions of the filters.
+ */
+
+static float MedianStep(void * filter, const float sample) {
+    return MedianFilterStep(filter, sample);
+}
+
+static void MedianClear(void * filter) {
+    MedianFilterClear(filter);
+}
+
+static float EMAStep(void * filter, const float sample) {
+    return EMAFilterStep(filter, sample);
+}
+
+static void EMAClear(void * filter) {
+    EMAFilterClear(filter);
+}
+
+static float SMAStep(void * filter, const float sample) {
+    return SMAFilterStep(filter, sample);
+}
+
+static void SMAClear(void * filter) {
+    SMAFilterClear(filter);
+}
+
+static float KalmanStep(void * filter, const float sample) {
+    KalmanFilterAddSample(filter, sample);
+    return KalmanFilterGetSample(filter);
+}
+
+static void KalmanClear(void * filter) {
+    KalmanFilterClear(filter);
+}
+
+static float KalmanVectorStep(void * filter, const float sample) {
+    return KalmanVectorFilterStep(filter, sample);
+}
+
+static void KalmanVectorClear(void * filter) {
+    KalmanVectorFilterClear(filter);
+}
+
+static float BiquadStep(void * filter, const float sample) {
+    return BiquadFilterStep(filter, sample);
+}
+
+static void BiquadBlock(void * filter, float * samples, const uint16_t numSamples) {
+    BiquadFilterProcessBlock(filter, samples, samples, numSamples);
+}
+
+static void BiquadClear(void * filter) {
+    BiquadFilterClear(filter);
+}
+
+static float FIRStep(void * filter, const float sample) {
+    return FIRFilterStep(filter, sample);
+}
+
+static void FIRBlock(void * filter, float * samples, const uint16_t numSamples) {
+    FIRFilterProcessBlock(filter, samples, samples, numSamples);
+}
+
+static void FIRClear(void * filter) {
+    FIRFilterClear(filter);
+}
+
+static float CICStep(void * filter, const float sample) {
+    /* A CIC takes 12-bit samples. Saturate instead of converting out of
+       range values, which is undefined. */
+    if (!(sample > 0.0f)) return CICFilterStep(filter, 0);
+    if (sample >= 4095.0f) return CICFilterStep(filter, 4095);
+    return CICFilterStep(filter, (uint16_t)sample);
+}
+
+static void CICClear(void * filter) {
+    CICFilterClear(filter);
+}
+
+static float HampelStep(void * filter, const float sample) {
+    return HampelFilterStep(filter, sample);
+}
+
+static void HampelClear(void * filter) {
+    HampelFilterClear(filter);
+}
+
+/**
+ * @brief Dispatch table indexed by filter type. Types without a step function
+ *        cannot be used as stages. A NULL processBlock falls back to stepping
+ *        through the block one sample at a time.
+ */
+static const FilterStage_t stageTable[NUM_FILTERS] = {
+    [FILTER_MEDIAN]={ NULL, MedianStep, NULL, MedianClear },
+    [FILTER_EMA]={ NULL, EMAStep, NULL, EMAClear },
+    [FILTER_SMA]={ NULL, SMAStep, NULL, SMAClear },
+    [FILTER_KALMAN]={ NULL, KalmanStep, NULL, KalmanClear },
+    [FILTER_BIQUAD]={ NULL, BiquadStep, BiquadBlock, BiquadClear },
+    [FILTER_FIR]={ NULL, FIRStep, FIRBlock, FIRClear },
+    [FILTER_CIC]={ NULL, CICStep, NULL, CICClear },
+    [FILTER_HAMPEL]={ NULL, HampelStep, NULL, HampelClear },
+    [FILTER_KALMAN_VECTOR]={ NULL, KalmanVectorStep, NULL, KalmanVectorClear },
+};
+
+FilterPipeline_t FilterPipelineInit(void * const filters[], const uint8_t numStages) {
+    /* Initialization asserts. */
+    assert(filters != NULL);
+    assert(0 < numStages && numStages <= FILTER_PIPELINE_MAX_STAGES);
+
+    FilterPipeline_t pipeline = {
+        .numStages=numStages,
+        .output=0
+    };
+
+    uint8_t i;
+    for (i = 0; i < numStages; ++i) {
+        /* Every filter struct starts with its Filter_t. */
+        const Filter_t * filter = filters[i];
+        assert(filter != NULL);
+        assert(filter->type < NUM_FILTERS);
+
+        FilterStage_t stage = stageTable[filter->type];
+        assert(stage.step != NULL);
+
+        /* Reject modes that do not take float samples. */
+        if (filter->type == FILTER_EMA) {
+            assert(((const EMAFilter_t *)filter)->mode == EMA_FLOAT);
+        } else if (filter->type == FILTER_SMA) {
+            assert(((const SMAFilter_t *)filter)->mode == SMA_FLOAT);
+        } else if (filter->type == FILTER_BIQUAD) {
+            assert(((const BiquadFilter_t *)filter)->mode == BIQUAD_FLOAT);
+        } else if (filter->type == FILTER_FIR) {
+            /* A decimating FIR produces fewer outputs than inputs, so it is
+               stepped one sample at a time to hold its last output. */
+            if (((const FIRFilter_t *)filter)->decimation > 1) {
+                stage.processBlock = NULL;
+            }
+        }
+
+        stage.filter = filters[i];
+        pipeline.stages[i] = stage;
+    }
+
+    return pipeline;
+}
+
+void FilterPipelineAddSample(FilterPipeline_t * pipeline, const float sample) {
+    float value = sample;
+    uint8_t i;
+    for (i = 0; i < pipeline->numStages; ++i) {
+        value = pipeline->stages[i].step(pipeline->stages[i].filter, value);
+    }
+    pipeline->output = value;
+}
+
+float FilterPipelineGetSample(const FilterPipeline_t * pipeline) {
+    return pipeline->output;
+}
+
+void FilterPipelineProcessBlock(FilterPipeline_t * pipeline, const float * input, float * output, const uint16_t numSamples) {
+    /* Initialization asserts. */
+    assert(pipeline != NULL);
+    assert(input != NULL);
+    assert(output != NULL);
+
+    if (numSamples == 0) return;
+
+    uint16_t j;
+    if (output != input) {
+        for (j = 0; j < numSamples; ++j) {
+            output[j] = input[j];
+        }
+    }
+
+    uint8_t i;
+    for (i = 0; i < pipeline->numStages; ++i) {
+        const FilterStage_t stage = pipeline->stages[i];
+        if (stage.processBlock != NULL) {
+            stage.processBlock(stage.filter, output, numSamples);
+            continue;
+        }
+        for (j = 0; j < numSamples; ++j) {
+            output[j] = stage.step(stage.filter, output[j]);
+        }
+    }
+
+    pipeline->output = output[numSamples - 1];
+}
+
+void FilterPipelineClear(FilterPipeline_t * pipeline) {
+    /* Initialization asserts. */
+    assert(pipeline != NULL);
+
+    uint8_t i;
+    for (i = 0; i < pipeline->numStages; ++i) {
+        pipeline->stages[i].clear(pipeline->stages[i].filter);
+    }
+    pipeline->output = 0;
+}
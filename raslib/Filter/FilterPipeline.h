@@ -0,0 +1,103 @@
+/**
+ * @file FilterPipeline.h
+ * @author agent (agent@local)
+ * @brief Chains heterogeneous filters into a single filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note
+ * A pipeline holds an ordered list of already initialized filters, such as a
+ * MedianFilter_t followed by a KalmanFilter_t for spike robust smoothing. Each
+ * sample is added to the first stage, and each stage's output is added to the
+ * next.
+ *
+ * Stages are resolved once, at init, by looking up the type in the Filter_t
+ * header of each filter in a dispatch table, and each filter is validated then.
+ * The hot path is then one indirect call per stage into the unchecked step
+ * function of the filter, with no per sample asserts. Supported stage types are FILTER_MEDIAN,
+ * FILTER_EMA (float mode), FILTER_SMA (float mode), FILTER_KALMAN,
+ * FILTER_KALMAN_VECTOR, FILTER_BIQUAD (float mode), FILTER_FIR, FILTER_CIC and
+ * FILTER_HAMPEL.
+ * Decimating stages hold their last output between decimated samples. A
+ * FILTER_CIC stage takes 12-bit samples, so its input is truncated and
+ * saturated to [0, 4095].
+ *
+ * The filters are owned by the caller and must outlive the pipeline.
+ */
+#pragma once
+
+/** Device Specific imports. */
+#include <raslib/Filter/Filter.h>
+
+
+/** @brief Maximum number of stages in a filter pipeline. */
+#define FILTER_PIPELINE_MAX_STAGES 4
+
+/**
+ * @brief FilterStage_t is a filter bound to the functions that run it.
+ */
+typedef struct FilterStage {
+    /** @brief Filter instance, starting with a Filter_t. */
+    void * filter;
+
+    /** @brief Adds a sample and returns the filter output. */
+    float (*step)(void * filter, const float sample);
+
+    /** @brief Runs a block of samples in place. */
+    void (*processBlock)(void * filter, float * samples, const uint16_t numSamples);
+
+    void (*clear)(void * filter);
+} FilterStage_t;
+
+typedef struct FilterPipeline {
+    FilterStage_t stages[FILTER_PIPELINE_MAX_STAGES];
+
+    uint8_t numStages;
+
+    /** @brief The last output of the final stage. */
+    float output;
+} FilterPipeline_t;
+
+/**
+ * @brief FilterPipelineInit builds a pipeline out of initialized filters.
+ *
+ * @param filters numStages pointers to filters such as MedianFilter_t or
+ *                KalmanFilter_t, in processing order.
+ * @param numStages Number of stages, from [1, FILTER_PIPELINE_MAX_STAGES].
+ * @return A FilterPipeline_t instance.
+ */
+FilterPipeline_t FilterPipelineInit(void * const filters[], const uint8_t numStages);
+
+/**
+ * @brief FilterPipelineAddSample runs a sample through every stage.
+ *
+ * @param pipeline Filter pipeline.
+ * @param sample Sample to add.
+ */
+void FilterPipelineAddSample(FilterPipeline_t * pipeline, const float sample);
+
+/**
+ * @brief FilterPipelineGetSample returns the last output of the final stage.
+ *
+ * @param pipeline Filter pipeline.
+ * @return The last output.
+ */
+float FilterPipelineGetSample(const FilterPipeline_t * pipeline);
+
+/**
+ * @brief FilterPipelineProcessBlock runs a block of samples through every
+ *        stage. The whole block passes through one stage before the next.
+ *
+ * @param pipeline Filter pipeline.
+ * @param input Input samples.
+ * @param output Output samples, one per input. May be the same as input.
+ * @param numSamples Number of samples in the block.
+ */
+void FilterPipelineProcessBlock(FilterPipeline_t * pipeline, const float * input, float * output, const uint16_t numSamples);
+
+/**
+ * @brief FilterPipelineClear clears every stage.
+ *
+ * @param pipeline Filter pipeline.
+ */
+void FilterPipelineClear(FilterPipeline_t * pipeline);
@@ -0,0 +1,204 @@
+/**
+ * @file HampelFilter.c
+ * @author agent (agent@local)
+ * @brief Hampel outlier rejection filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ */
+
+/** General imports. */
+#include <assert.h>
+#include <stdlib.h>
+
+/** Device Specific imports. */
+#include <raslib/Filter/HampelFilter.h>
+
+
+/** @brief Ratio of the standard deviation to the MAD for normal data. */
+#define HAMPEL_MAD_TO_SIGMA 1.4826f
+
+/** @brief Ratio of the standard deviation to the mean absolute deviation for
+ *         normal data. */
+#define HAMPEL_MEAN_DEV_TO_SIGMA 1.2533f
+
+HampelFilter_t HampelFilterInit(const FilterConfig_t config, const uint16_t windowSize, const float k, const float minDeviation) {
+    /* Initialization asserts. */
+    assert(config.type == FILTER_HAMPEL);
+    assert(config.buffer != NULL);
+    assert(windowSize > 0);
+    assert(config.bufferSize >= 2 * (uint32_t)windowSize);
+    assert(k > 0.0f);
+    assert(minDeviation >= 0.0f);
+
+    Filter_t filter = {
+        .type=config.type,
+        .buffer=config.buffer,
+        .bufferSize=config.bufferSize
+    };
+
+    HampelFilter_t hampelFilter = {
+        .filter=filter,
+        .windowSize=windowSize,
+        .k=k,
+        .minDeviation=minDeviation,
+        .center=0,
+        .deviation=0,
+        .output=0,
+        .numRejected=0,
+        .curIdx=0,
+        .numSamples=0
+    };
+
+    return hampelFilter;
+}
+
+/**
+ * @brief HampelSelect partially sorts values so that values[rank] is the
+ *        rank-th smallest value, using Hoare's selection algorithm.
+ *
+ * @param values Values to select from. Reordered.
+ * @param numValues Number of values.
+ * @param rank Rank to select, from [0, numValues).
+ * @return The rank-th smallest value.
+ */
+static float HampelSelect(float * values, const uint16_t numValues, const uint16_t rank) {
+    int16_t left = 0;
+    int16_t right = numValues - 1;
+    while (left < right) {
+        float pivot = values[rank];
+        int16_t i = left;
+        int16_t j = right;
+        do {
+            while (values[i] < pivot) ++i;
+            while (pivot < values[j]) --j;
+            if (i <= j) {
+                float temp = values[i];
+                values[i] = values[j];
+                values[j] = temp;
+                ++i;
+                --j;
+            }
+        } while (i <= j);
+        if (j < rank) left = i;
+        if (rank < i) right = j;
+    }
+    return values[rank];
+}
+
+/**
+ * @brief HampelFilterCheckWindow computes the exact window median and MAD and
+ *        decides whether the newest sample is an outlier. The running
+ *        estimates are reset to the exact ones.
+ *
+ * @param filter Hampel filter.
+ * @param sample The newest sample, already in the window.
+ * @return True if the sample is an outlier.
+ */
+static bool HampelFilterCheckWindow(HampelFilter_t * filter, const float sample) {
+    const uint16_t numSamples = filter->numSamples;
+    float * window = filter->filter.buffer;
+    float * scratch = filter->filter.buffer + filter->windowSize;
+
+    uint16_t i;
+    for (i = 0; i < numSamples; ++i) {
+        scratch[i] = window[i];
+    }
+    float median = HampelSelect(scratch, numSamples, numSamples / 2);
+
+    for (i = 0; i < numSamples; ++i) {
+        float diff = scratch[i] - median;
+        scratch[i] = diff < 0 ? -diff : diff;
+    }
+    float mad = HampelSelect(scratch, numSamples, numSamples / 2);
+
+    filter->center = median;
+    filter->deviation = HAMPEL_MAD_TO_SIGMA * mad;
+
+    float deviation = filter->deviation > filter->minDeviation ? filter->deviation : filter->minDeviation;
+    float error = sample - median;
+    if (error < 0) error = -error;
+    return error > filter->k * deviation;
+}
+
+/**
+ * @brief HampelFilterUpdate adds a sample to the window and decides whether
+ *        it is an outlier.
+ *
+ * @param filter Hampel filter.
+ * @param sample Sample to add.
+ * @return True if the sample was rejected and replaced by the window median.
+ */
+STATIC_INLINE bool HampelFilterUpdate(HampelFilter_t * filter, const float sample) {
+    /* The window always holds raw samples, including rejected ones. */
+    filter->filter.buffer[filter->curIdx] = sample;
+    if (++filter->curIdx == filter->windowSize) filter->curIdx = 0;
+    if (filter->numSamples < filter->windowSize) filter->numSamples++;
+
+    float deviation = filter->deviation > filter->minDeviation ? filter->deviation : filter->minDeviation;
+    float error = sample - filter->center;
+    if (error < 0) error = -error;
+
+    if (error <= filter->k * deviation) {
+        /* Common path. Update the running estimates with a window length
+           EMA. */
+        float alpha = 2.0f / (filter->windowSize + 1);
+        filter->center += alpha * (sample - filter->center);
+        filter->deviation += alpha * (HAMPEL_MEAN_DEV_TO_SIGMA * error - filter->deviation);
+        filter->output = sample;
+        return false;
+    }
+
+    /* Slow path. Confirm against the exact window statistics. */
+    if (HampelFilterCheckWindow(filter, sample)) {
+        filter->output = filter->center;
+        filter->numRejected++;
+        return true;
+    }
+
+    filter->output = sample;
+    return false;
+}
+
+bool HampelFilterAddSample(HampelFilter_t * filter, const float sample) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_HAMPEL);
+    assert(filter->curIdx < filter->windowSize);
+
+    return HampelFilterUpdate(filter, sample);
+}
+
+float HampelFilterStep(HampelFilter_t * filter, const float sample) {
+    HampelFilterUpdate(filter, sample);
+    return filter->output;
+}
+
+float HampelFilterGetSample(const HampelFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_HAMPEL);
+
+    return filter->output;
+}
+
+uint32_t HampelFilterGetRejectedCount(const HampelFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_HAMPEL);
+
+    return filter->numRejected;
+}
+
+void HampelFilterClear(HampelFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_HAMPEL);
+
+    filter->center = 0;
+    filter->deviation = 0;
+    filter->output = 0;
+    filter->numRejected = 0;
+    filter->curIdx = 0;
+    filter->numSamples = 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file HampelFilter.h
+ * @author agent (agent@local)
+ * @brief Hampel outlier rejection filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note
+ * A Hampel filter passes a sample through unchanged unless it is more than
+ * k standard deviations from the median of the last windowSize samples, in
+ * which case the sample is replaced by that median. The standard deviation is
+ * estimated as 1.4826 * MAD, the median absolute deviation from the median.
+ * Unlike a median filter, samples that are not outliers are not delayed or
+ * smoothed.
+ *
+ * Computing the window median and MAD for every sample is O(windowSize). This
+ * filter instead keeps a running center and deviation estimate, updated from
+ * accepted samples, and checks each sample against them first:
+ * - Common path, O(1). The sample is within k deviations of the running
+ *   center. It is accepted and the running estimates are updated.
+ * - Slow path, O(windowSize). The sample is a candidate outlier. The exact
+ *   window median and MAD are computed. The sample is rejected if it is still
+ *   more than k deviations from the median. Otherwise it is accepted, such as
+ *   after a step change, and the running estimates are reset to the exact
+ *   ones.
+ *
+ * The buffer holds the window of raw samples, followed by windowSize floats of
+ * scratch space for the slow path.
+ */
+#pragma once
+
+/** Device Specific imports. */
+#include <raslib/Filter/Filter.h>
+
+
+typedef struct HampelFilter {
+    Filter_t filter;
+
+    /** @brief Number of samples in the window. */
+    uint16_t windowSize;
+
+    /** @brief Rejection threshold, in standard deviations. */
+    float k;
+
+    /** @brief Lower bound on the deviation estimate, such as 1 ADC code for
+     *         flat quantized signals. */
+    float minDeviation;
+
+    /** @brief Running estimate of the window median. */
+    float center;
+
+    /** @brief Running estimate of the standard deviation. */
+    float deviation;
+
+    /** @brief The last output. */
+    float output;
+
+    /** @brief Number of samples replaced since the last clear. */
+    uint32_t numRejected;
+
+    uint16_t curIdx;
+
+    uint16_t numSamples;
+} HampelFilter_t;
+
+/**
+ * @brief HampelFilterInit initializes a Hampel filter.
+ *
+ * @param config Filter configuration. The buffer must hold at least
+ *               2 * windowSize floats.
+ * @param windowSize Number of samples in the window, greater than zero.
+ * @param k Rejection threshold, in standard deviations. 3 is typical.
+ * @param minDeviation Lower bound on the deviation estimate, at least zero.
+ * @return A HampelFilter_t instance.
+ */
+HampelFilter_t HampelFilterInit(const FilterConfig_t config, const uint16_t windowSize, const float k, const float minDeviation);
+
+/**
+ * @brief HampelFilterAddSample adds a sample to the filter.
+ *
+ * @param filter Hampel filter.
+ * @param sample Sample to add.
+ * @return True if the sample was rejected and replaced by the window median.
+ */
+bool HampelFilterAddSample(HampelFilter_t * filter, const float sample);
+
+/**
+ * @brief HampelFilterGetSample returns the last output: the last sample if it
+ *        was accepted, otherwise the window median.
+ *
+ * @param filter Hampel filter.
+ * @return The last output.
+ */
+float HampelFilterGetSample(const HampelFilter_t * filter);
+
+/**
+ * @brief HampelFilterStep adds a sample and returns the new output, like
+ *        HampelFilterAddSample followed by HampelFilterGetSample, but without
+ *        checking its arguments. It is meant for callers that validated the
+ *        filter once, such as a FilterPipeline_t.
+ *
+ * @param filter Hampel filter.
+ * @param sample Sample to add.
+ * @return The new output.
+ */
+float HampelFilterStep(HampelFilter_t * filter, const float sample);
+
+/**
+ * @brief HampelFilterGetRejectedCount returns the number of samples replaced
+ *        since the last clear.
+ *
+ * @param filter Hampel filter.
+ * @return The number of rejected samples.
+ */
+uint32_t HampelFilterGetRejectedCount(const HampelFilter_t * filter);
+
+/**
+ * @brief HampelFilterClear empties the window and resets the rejected count.
+ *
+ * @param filter Hampel filter.
+ */
+void HampelFilterClear(HampelFilter_t * filter);
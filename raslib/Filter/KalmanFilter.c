@@ -34,26 +34,73 @@ KalmanFilter_t KalmanFilterInit(const FilterConfig_t config, const float initial
         .mEstimate=initialEstimate,
         .mEu=estimateUncertainty,
         .mMu=measurementUncertainty,
-        .mQ=processNoiseVariance
+        .mQ=processNoiseVariance,
+        .mode=KALMAN_DYNAMIC,
+        .mK=0,
+        .mEstimateQ16=0,
+        .mKQ16=0
     };
 
     return kalmanFilter;
 }
 
+KalmanFilter_t KalmanFilterSteadyStateInit(const FilterConfig_t config, const float initialEstimate, const float measurementUncertainty, const float processNoiseVariance, const bool isFixedPoint) {
+    /* Initialization asserts. */
+    assert(measurementUncertainty > 0.0f);
+    assert(processNoiseVariance >= 0.0f);
+    assert(!isFixedPoint || (-32768.0f <= initialEstimate && initialEstimate <= 32767.0f));
+
+    /* Steady state prior uncertainty. Positive root of P^2 - QP - QR = 0. */
+    float R = measurementUncertainty;
+    float Q = processNoiseVariance;
+    float P = (Q + sqrtf(Q * Q + 4.0f * Q * R)) / 2.0f;
+
+    KalmanFilter_t kalmanFilter = KalmanFilterInit(config, initialEstimate, P, R, Q);
+    kalmanFilter.mode = isFixedPoint ? KALMAN_STEADY_Q16 : KALMAN_STEADY;
+    kalmanFilter.mK = P / (P + R);
+    kalmanFilter.mKQ16 = (int32_t)(kalmanFilter.mK * 65536.0f + 0.5f);
+    kalmanFilter.mEstimateQ16 = (int32_t)(initialEstimate * 65536.0f);
+
+    return kalmanFilter;
+}
+
 void KalmanFilterAddSample(KalmanFilter_t * filter, const float sample) {
+    if (filter->mode == KALMAN_STEADY) {
+        filter->mEstimate += filter->mK * (sample - filter->mEstimate);
+        return;
+    } else if (filter->mode == KALMAN_STEADY_Q16) {
+        KalmanFilterAddIntSample(filter, (int16_t)sample);
+        return;
+    }
+
     /* Kalman Gain. */
-    double K = filter->mEu / (filter->mEu + filter->mMu);
+    float K = filter->mEu / (filter->mEu + filter->mMu);
     /* Estimate update (state update). */
     filter->mEstimate = filter->mEstimate + K * (sample - filter->mEstimate);
     /* Estimate uncertainty. */
-    filter->mEu = (1-K) * filter->mEu;
+    filter->mEu = (1.0f - K) * filter->mEu;
     /* Predict estimate. */
     // mEstimate = mEstimate;
     /* Predict estimate uncertainty. */
     filter->mEu = filter->mEu + filter->mQ;
 }
 
+void KalmanFilterAddIntSample(KalmanFilter_t * filter, const int16_t sample) {
+    if (filter->mode != KALMAN_STEADY_Q16) {
+        KalmanFilterAddSample(filter, (float)sample);
+        return;
+    }
+
+    /* Q16.16 estimate update. The error fits in 33 bits and the gain in 17
+       bits, so the update is computed in 64 bits. */
+    int64_t error = ((int64_t)sample << 16) - filter->mEstimateQ16;
+    filter->mEstimateQ16 += (int32_t)((filter->mKQ16 * error) >> 16);
+}
+
 float KalmanFilterGetSample(KalmanFilter_t * filter) {
+    if (filter->mode == KALMAN_STEADY_Q16) {
+        return filter->mEstimateQ16 / 65536.0f;
+    }
     return filter->mEstimate;
 }
 
@@ -62,4 +109,5 @@ void KalmanFilterClear(KalmanFilter_t * filter) {
     filter->mEu = filter->userSettings[1];
     filter->mMu = filter->userSettings[2];
     filter->mQ = filter->userSettings[3];
+    filter->mEstimateQ16 = (int32_t)(filter->userSettings[0] * 65536.0f);
 }
\ No newline at end of file
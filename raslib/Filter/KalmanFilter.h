@@ -6,6 +6,14 @@
  * @date 2021-11-03
  * @copyright Copyright (c) 2021
  * @note Source: https://www.kalmanfilter.net/kalman1d.html
+ * @note
+ * All math is single precision, which the Cortex-M4F FPU executes in
+ * hardware. Two additional modes skip the per sample gain division:
+ * - Steady state (KALMAN_STEADY). The gain that the filter converges to for
+ *   a constant measurement uncertainty and process noise is computed once in
+ *   KalmanFilterSteadyStateInit.
+ * - Steady state fixed point (KALMAN_STEADY_Q16). As above, but the estimate
+ *   and gain are kept in Q16.16 so each sample is one integer multiply.
  */
 #pragma once
 
@@ -13,6 +21,14 @@
 #include <raslib/Filter/Filter.h>
 
 
+/** @brief KalmanFilterMode is an enumeration specifying how the Kalman gain
+ *         is computed. */
+enum KalmanFilterMode {
+    KALMAN_DYNAMIC,
+    KALMAN_STEADY,
+    KALMAN_STEADY_Q16
+};
+
 typedef struct KalmanFilter {
     Filter_t filter;
 
@@ -25,12 +41,55 @@ typedef struct KalmanFilter {
     float mMu;
 
     float mQ;
+
+    enum KalmanFilterMode mode;
+
+    /** @brief Steady state modes only. The precomputed Kalman gain. */
+    float mK;
+
+    /** @brief KALMAN_STEADY_Q16 only. The estimate in Q16.16. */
+    int32_t mEstimateQ16;
+
+    /** @brief KALMAN_STEADY_Q16 only. The precomputed Kalman gain in Q16.16. */
+    int32_t mKQ16;
 } KalmanFilter_t;
 
 KalmanFilter_t KalmanFilterInit(const FilterConfig_t config, const float initialEstimate, const float estimateUncertainty, const float measurementUncertainty, const float processNoiseVariance);
 
+/**
+ * @brief KalmanFilterSteadyStateInit initializes a Kalman filter that uses the
+ *        steady state gain for the given noise parameters. The steady state
+ *        prior uncertainty P solves P = P * R / (P + R) + Q, and the gain is
+ *        P / (P + R).
+ *
+ * @param config Filter configuration.
+ * @param initialEstimate The initial estimate.
+ * @param measurementUncertainty The measurement uncertainty R.
+ * @param processNoiseVariance The process noise variance Q.
+ * @param isFixedPoint Whether to run the filter in Q16.16 fixed point. The
+ *                     estimate must then fit in [-32768, 32767].
+ * @return A KalmanFilter_t instance.
+ */
+KalmanFilter_t KalmanFilterSteadyStateInit(const FilterConfig_t config, const float initialEstimate, const float measurementUncertainty, const float processNoiseVariance, const bool isFixedPoint);
+
+/**
+ * @brief KalmanFilterAddSample adds a sample to the filter.
+ *
+ * @param filter Kalman filter.
+ * @param sample Sample to add. In KALMAN_STEADY_Q16 mode, the sample is
+ *               truncated to an integer.
+ */
 void KalmanFilterAddSample(KalmanFilter_t * filter, const float sample);
 
+/**
+ * @brief KalmanFilterAddIntSample adds an integer sample, such as a raw ADC
+ *        code. In KALMAN_STEADY_Q16 mode no floating point math is used.
+ *
+ * @param filter Kalman filter.
+ * @param sample Sample to add, from [-32768, 32767].
+ */
+void KalmanFilterAddIntSample(KalmanFilter_t * filter, const int16_t sample);
+
 float KalmanFilterGetSample(KalmanFilter_t * filter);
 
 void KalmanFilterClear(KalmanFilter_t * filter);
\ No newline at end of file
@@ -0,0 +1,187 @@
+/**
+ * @file KalmanVectorFilter.c
+ * @author agent (agent@local)
+ * @brief Small fixed dimension linear Kalman filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note Source: https://www.kalmanfilter.net/multiSummary.html
+ */
+
+/** General imports. */
+#include <assert.h>
+#include <stdlib.h>
+
+/** Device Specific imports. */
+#include <raslib/Filter/KalmanVectorFilter.h>
+
+
+KalmanVectorFilter_t KalmanVectorFilterInit(const FilterConfig_t config, const uint8_t numStates, const float dt, const float initialPosition, const float estimateUncertainty, const float measurementUncertainty, const float processNoiseVariance) {
+    /* Initialization asserts. */
+    assert(config.type == FILTER_KALMAN_VECTOR);
+    assert(config.buffer != NULL);
+    assert(2 <= numStates && numStates <= KALMAN_VECTOR_MAX_STATES);
+    assert(config.bufferSize >= KALMAN_VECTOR_BUFFER_SIZE(numStates));
+    assert(dt > 0.0f);
+    assert(measurementUncertainty > 0.0f);
+
+    Filter_t filter = {
+        .type=config.type,
+        .buffer=config.buffer,
+        .bufferSize=config.bufferSize,
+    };
+
+    uint8_t n = numStates;
+    KalmanVectorFilter_t kalmanFilter = {
+        .filter=filter,
+        .userSettings={initialPosition, estimateUncertainty, measurementUncertainty, processNoiseVariance, dt},
+        .numStates=n,
+        .x=config.buffer,
+        .P=config.buffer + n,
+        .F=config.buffer + n + n * n,
+        .Q=config.buffer + n + 2 * n * n,
+        .H=config.buffer + n + 3 * n * n,
+        .mMu=measurementUncertainty
+    };
+
+    /* The kinematic chain F[i][j] = dt^(j-i) / (j-i)! for j >= i, and the
+       noise gain G[i] = dt^(n-i) / (n-i)!, so Q = G * G^T * q. */
+    float terms[KALMAN_VECTOR_MAX_STATES + 1];
+    terms[0] = 1.0f;
+    uint8_t i, j;
+    for (i = 1; i <= n; ++i) {
+        terms[i] = terms[i - 1] * dt / i;
+    }
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < n; ++j) {
+            kalmanFilter.F[i * n + j] = j >= i ? terms[j - i] : 0.0f;
+            kalmanFilter.Q[i * n + j] = terms[n - i] * terms[n - j] * processNoiseVariance;
+        }
+        kalmanFilter.H[i] = i == 0 ? 1.0f : 0.0f;
+    }
+
+    KalmanVectorFilterClear(&kalmanFilter);
+
+    return kalmanFilter;
+}
+
+/**
+ * @brief KalmanVectorStep runs one predict and update cycle. It is always
+ *        called with a constant n so that each size gets its own fully
+ *        unrolled copy of the matrix kernels.
+ *
+ * @param filter Kalman filter.
+ * @param z Measurement.
+ * @param n Number of states.
+ */
+STATIC_INLINE void KalmanVectorStep(KalmanVectorFilter_t * filter, const float z, const uint8_t n) {
+    /* Work on local copies. The matrices share one buffer, so working in
+       place would force the compiler to reload every entry after each store. */
+    float x[KALMAN_VECTOR_MAX_STATES];
+    float P[KALMAN_VECTOR_MAX_STATES * KALMAN_VECTOR_MAX_STATES];
+    float F[KALMAN_VECTOR_MAX_STATES * KALMAN_VECTOR_MAX_STATES];
+    float H[KALMAN_VECTOR_MAX_STATES];
+    float tmp[KALMAN_VECTOR_MAX_STATES * KALMAN_VECTOR_MAX_STATES];
+    float vec[KALMAN_VECTOR_MAX_STATES];
+    uint8_t i, j, k;
+
+    for (i = 0; i < n; ++i) {
+        x[i] = filter->x[i];
+        H[i] = filter->H[i];
+        for (j = 0; j < n; ++j) {
+            P[i * n + j] = filter->P[i * n + j];
+            F[i * n + j] = filter->F[i * n + j];
+        }
+    }
+
+    /* Predict state. x = F * x. */
+    for (i = 0; i < n; ++i) {
+        vec[i] = 0.0f;
+        for (k = 0; k < n; ++k) vec[i] += F[i * n + k] * x[k];
+    }
+
+    /* Predict covariance. P = F * P * F^T + Q. */
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < n; ++j) {
+            tmp[i * n + j] = 0.0f;
+            for (k = 0; k < n; ++k) tmp[i * n + j] += F[i * n + k] * P[k * n + j];
+        }
+    }
+    for (i = 0; i < n; ++i) {
+        x[i] = vec[i];
+        for (j = 0; j < n; ++j) {
+            float sum = filter->Q[i * n + j];
+            for (k = 0; k < n; ++k) sum += tmp[i * n + k] * F[j * n + k];
+            P[i * n + j] = sum;
+        }
+    }
+
+    /* Innovation. vec = P * H^T, S = H * P * H^T + R, y = z - H * x. */
+    float S = filter->mMu;
+    float y = z;
+    for (i = 0; i < n; ++i) {
+        vec[i] = 0.0f;
+        for (k = 0; k < n; ++k) vec[i] += P[i * n + k] * H[k];
+        S += H[i] * vec[i];
+        y -= H[i] * x[i];
+    }
+
+    /* Kalman gain K = vec / S. Update state x = x + K * y and covariance
+       P = P - K * (H * P). P is symmetric, so H * P = vec^T. */
+    float invS = 1.0f / S;
+    for (i = 0; i < n; ++i) {
+        float K = vec[i] * invS;
+        filter->x[i] = x[i] + K * y;
+        for (j = 0; j < n; ++j) filter->P[i * n + j] = P[i * n + j] - K * vec[j];
+    }
+}
+
+float KalmanVectorFilterStep(KalmanVectorFilter_t * filter, const float sample) {
+    switch (filter->numStates) {
+        case 2:
+            KalmanVectorStep(filter, sample, 2);
+            break;
+        case 3:
+            KalmanVectorStep(filter, sample, 3);
+            break;
+        case 4:
+            KalmanVectorStep(filter, sample, 4);
+            break;
+        default:
+            break;
+    }
+    return filter->x[0];
+}
+
+void KalmanVectorFilterAddSample(KalmanVectorFilter_t * filter, const float sample) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_KALMAN_VECTOR);
+    assert(2 <= filter->numStates && filter->numStates <= KALMAN_VECTOR_MAX_STATES);
+
+    KalmanVectorFilterStep(filter, sample);
+}
+
+float KalmanVectorFilterGetSample(const KalmanVectorFilter_t * filter) {
+    return filter->x[0];
+}
+
+float KalmanVectorFilterGetState(const KalmanVectorFilter_t * filter, const uint8_t state) {
+    assert(state < filter->numStates);
+    return filter->x[state];
+}
+
+void KalmanVectorFilterClear(KalmanVectorFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_KALMAN_VECTOR);
+
+    uint8_t n = filter->numStates;
+    uint8_t i, j;
+    for (i = 0; i < n; ++i) {
+        filter->x[i] = i == 0 ? filter->userSettings[0] : 0.0f;
+        for (j = 0; j < n; ++j) {
+            filter->P[i * n + j] = i == j ? filter->userSettings[1] : 0.0f;
+        }
+    }
+}
@@ -0,0 +1,130 @@
+/**
+ * @file KalmanVectorFilter.h
+ * @author agent (agent@local)
+ * @brief Small fixed dimension linear Kalman filter.
+ * @version 0.1
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026
+ * @note Source: https://www.kalmanfilter.net/multiSummary.html
+ * @note
+ * Tracks a state vector of 2 to 4 kinematic states (position, velocity,
+ * acceleration, jerk) from a scalar measurement. The model is a discrete
+ * kinematic chain: with 2 states it is a constant velocity model, with 3
+ * states a constant acceleration model, and so on. Process noise enters
+ * through the highest order state.
+ *
+ * All matrices live in the caller owned FilterConfig_t buffer, which must
+ * hold at least KALMAN_VECTOR_BUFFER_SIZE(numStates) floats. The state
+ * transition F, process noise Q and measurement row H are initialized for the
+ * kinematic model but may be overwritten by the user after initialization.
+ * No heap is used.
+ */
+#pragma once
+
+/** Device Specific imports. */
+#include <raslib/Filter/Filter.h>
+
+
+/** @brief Maximum number of states tracked. */
+#define KALMAN_VECTOR_MAX_STATES 4
+
+/**
+ * @brief Number of buffer entries required for n states: the state x (n),
+ *        covariance P (n * n), transition F (n * n), process noise Q (n * n)
+ *        and measurement row H (n).
+ */
+#define KALMAN_VECTOR_BUFFER_SIZE(n) ((n) * (3 * (n) + 2))
+
+typedef struct KalmanVectorFilter {
+    Filter_t filter;
+
+    /** @brief initialPosition, estimateUncertainty, measurementUncertainty,
+     *         processNoiseVariance and dt, in that order. */
+    float userSettings[5];
+
+    /** @brief Number of states, from [2, KALMAN_VECTOR_MAX_STATES]. */
+    uint8_t numStates;
+
+    /** @brief State estimate, numStates entries. */
+    float * x;
+
+    /** @brief Estimate covariance, row major numStates x numStates. */
+    float * P;
+
+    /** @brief State transition matrix, row major numStates x numStates. */
+    float * F;
+
+    /** @brief Process noise covariance, row major numStates x numStates. */
+    float * Q;
+
+    /** @brief Measurement row, numStates entries. Defaults to measuring the
+     *         position only. */
+    float * H;
+
+    /** @brief Measurement uncertainty (variance) R. */
+    float mMu;
+} KalmanVectorFilter_t;
+
+/**
+ * @brief KalmanVectorFilterInit initializes a kinematic Kalman filter.
+ *
+ * @param config Filter configuration, of type FILTER_KALMAN_VECTOR. The
+ *               buffer must hold at least KALMAN_VECTOR_BUFFER_SIZE(numStates)
+ *               floats.
+ * @param numStates Number of states, from [2, KALMAN_VECTOR_MAX_STATES].
+ * @param dt Time between samples, in seconds.
+ * @param initialPosition The initial position estimate. All other states
+ *                        start at zero.
+ * @param estimateUncertainty The initial variance of every state.
+ * @param measurementUncertainty The measurement variance R.
+ * @param processNoiseVariance The variance of the highest order state's
+ *                             random walk per second.
+ * @return A KalmanVectorFilter_t instance.
+ */
+KalmanVectorFilter_t KalmanVectorFilterInit(const FilterConfig_t config, const uint8_t numStates, const float dt, const float initialPosition, const float estimateUncertainty, const float measurementUncertainty, const float processNoiseVariance);
+
+/**
+ * @brief KalmanVectorFilterAddSample predicts the state forward by dt and
+ *        then corrects it with the measurement.
+ *
+ * @param filter Kalman filter.
+ * @param sample The measurement, as seen through H.
+ */
+void KalmanVectorFilterAddSample(KalmanVectorFilter_t * filter, const float sample);
+
+/**
+ * @brief KalmanVectorFilterGetSample returns the position estimate.
+ *
+ * @param filter Kalman filter.
+ * @return The first state.
+ */
+float KalmanVectorFilterGetSample(const KalmanVectorFilter_t * filter);
+
+/**
+ * @brief KalmanVectorFilterStep adds a sample and returns the new output, like
+ *        KalmanVectorFilterAddSample followed by KalmanVectorFilterGetSample, but without
+ *        checking its arguments. It is meant for callers that validated the
+ *        filter once, such as a FilterPipeline_t.
+ *
+ * @param filter Kalman filter.
+ * @param sample Sample to add.
+ * @return The new output.
+ */
+float KalmanVectorFilterStep(KalmanVectorFilter_t * filter, const float sample);
+
+/**
+ * @brief KalmanVectorFilterGetState returns a single state estimate.
+ *
+ * @param filter Kalman filter.
+ * @param state State index. 0 is position, 1 is velocity, and so on.
+ * @return The state estimate.
+ */
+float KalmanVectorFilterGetState(const KalmanVectorFilter_t * filter, const uint8_t state);
+
+/**
+ * @brief KalmanVectorFilterClear resets the state and covariance to their
+ *        initial values. F, Q and H are left untouched.
+ *
+ * @param filter Kalman filter.
+ */
+void KalmanVectorFilterClear(KalmanVectorFilter_t * filter);
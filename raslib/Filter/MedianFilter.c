@@ -9,6 +9,11 @@
  * Ollie Niemitalo, who licensed his code under CC0 1.0. The
  * original source can be found here: 
  * https://dsp.stackexchange.com/a/36886 
+ * 
+ * The heap mode is adapted from the rolling median "Mediator" written by
+ * Adam Shelly, which keeps a max heap, the median, and a min heap in a single
+ * array. The original source can be found here:
+ * https://stackoverflow.com/a/5970314
  */
 
 /** General imports. */
@@ -37,20 +42,145 @@ MedianFilter_t MedianFilterInit(const FilterConfig_t config) {
         .filter=filter,
         .curIdx=0,
         .maxSampleWindow=filter.bufferSize % 2 ? filter.bufferSize : filter.bufferSize - 1,
-        .median=0
+        .median=0,
+        .mode=MEDIAN_SCAN,
+        .heapPos=NULL,
+        .heap=NULL
     };
 
     return medianFilter;
 }
 
-void MedianFilterAddSample(MedianFilter_t * filter, const float sample) {
+/**
+ * @brief MedianHeapReset zeroes the sample window and lays out the heap in
+ *        the fill pattern median, max, min, max, min, ... Since every sample
+ *        is identical, any layout is a valid heap.
+ *
+ * @param filter Heap mode median filter to reset.
+ */
+static void MedianHeapReset(MedianFilter_t * filter) {
+    int32_t i;
+    for (i = 0; i < filter->maxSampleWindow; ++i) {
+        filter->filter.buffer[i] = 0;
+        filter->heapPos[i] = ((i + 1) / 2) * ((i & 1) ? -1 : 1);
+        filter->heap[filter->heapPos[i]] = i;
+    }
+}
+
+MedianFilter_t MedianFilterHeapInit(const FilterConfig_t config, int16_t * indexBuffer) {
     /* Initialization asserts. */
-    assert(filter != NULL);
-    assert(filter->filter.type == FILTER_MEDIAN);
-    assert(filter->filter.buffer != NULL);
-    assert(filter->filter.bufferSize > 0);
-    assert(filter->maxSampleWindow % 2 && filter->maxSampleWindow <= filter->filter.bufferSize);
-    assert(filter->curIdx < filter->filter.bufferSize);
+    assert(indexBuffer != NULL);
+    assert(config.bufferSize <= INT16_MAX);
+
+    MedianFilter_t medianFilter = MedianFilterInit(config);
+    medianFilter.mode = MEDIAN_HEAP;
+
+    /* The first half of the index buffer holds the heap positions of each
+       sample, the second half holds the heap itself, centered on the median. */
+    medianFilter.heapPos = indexBuffer;
+    medianFilter.heap = indexBuffer + config.bufferSize + medianFilter.maxSampleWindow / 2;
+    MedianHeapReset(&medianFilter);
+
+    return medianFilter;
+}
+
+/** @brief Returns whether the sample at heap position i is less than j. */
+static bool MedianHeapLess(MedianFilter_t * filter, int32_t i, int32_t j) {
+    return filter->filter.buffer[filter->heap[i]] < filter->filter.buffer[filter->heap[j]];
+}
+
+/**
+ * @brief MedianHeapCompareExchange swaps heap positions i and j if the sample
+ *        at i is less than the sample at j.
+ *
+ * @return Whether the swap occurred.
+ */
+static bool MedianHeapCompareExchange(MedianFilter_t * filter, int32_t i, int32_t j) {
+    if (!MedianHeapLess(filter, i, j)) return false;
+
+    int16_t temp = filter->heap[i];
+    filter->heap[i] = filter->heap[j];
+    filter->heap[j] = temp;
+    filter->heapPos[filter->heap[i]] = i;
+    filter->heapPos[filter->heap[j]] = j;
+    return true;
+}
+
+/** @brief Restores the min heap property for all items below position i/2. */
+static void MedianHeapMinSortDown(MedianFilter_t * filter, int32_t i) {
+    int32_t count = (filter->maxSampleWindow - 1) / 2;
+    for (; i <= count; i *= 2) {
+        if (i > 1 && i < count && MedianHeapLess(filter, i + 1, i)) ++i;
+        if (!MedianHeapCompareExchange(filter, i, i / 2)) break;
+    }
+}
+
+/** @brief Restores the max heap property for all items below position i/2. */
+static void MedianHeapMaxSortDown(MedianFilter_t * filter, int32_t i) {
+    int32_t count = (filter->maxSampleWindow - 1) / 2;
+    for (; i >= -count; i *= 2) {
+        if (i < -1 && i > -count && MedianHeapLess(filter, i, i - 1)) --i;
+        if (!MedianHeapCompareExchange(filter, i / 2, i)) break;
+    }
+}
+
+/**
+ * @brief Restores the min heap property for all items above position i.
+ *
+ * @return Whether the item was promoted to the median.
+ */
+static bool MedianHeapMinSortUp(MedianFilter_t * filter, int32_t i) {
+    while (i > 0 && MedianHeapCompareExchange(filter, i, i / 2)) i /= 2;
+    return i == 0;
+}
+
+/**
+ * @brief Restores the max heap property for all items above position i.
+ *
+ * @return Whether the item was promoted to the median.
+ */
+static bool MedianHeapMaxSortUp(MedianFilter_t * filter, int32_t i) {
+    while (i < 0 && MedianHeapCompareExchange(filter, i / 2, i)) i /= 2;
+    return i == 0;
+}
+
+/**
+ * @brief MedianHeapAddSample replaces the oldest sample in the window and
+ *        sifts it to its new position in O(log n).
+ *
+ * @param filter Heap mode median filter.
+ * @param sample Sample to add.
+ */
+static void MedianHeapAddSample(MedianFilter_t * filter, const float sample) {
+    int32_t pos = filter->heapPos[filter->curIdx];
+    float removeValue = filter->filter.buffer[filter->curIdx];
+    filter->filter.buffer[filter->curIdx] = sample;
+
+    if (pos > 0) {
+        /* Sample is in the min heap. */
+        if (removeValue < sample) MedianHeapMinSortDown(filter, pos * 2);
+        else if (MedianHeapMinSortUp(filter, pos)) MedianHeapMaxSortDown(filter, -1);
+    } else if (pos < 0) {
+        /* Sample is in the max heap. */
+        if (sample < removeValue) MedianHeapMaxSortDown(filter, pos * 2);
+        else if (MedianHeapMaxSortUp(filter, pos)) MedianHeapMinSortDown(filter, 1);
+    } else {
+        /* Sample is the median. */
+        MedianHeapMaxSortDown(filter, -1);
+        MedianHeapMinSortDown(filter, 1);
+    }
+
+    filter->median = filter->filter.buffer[filter->heap[0]];
+
+    /* Wrap without a hardware divide. */
+    if (++filter->curIdx == filter->maxSampleWindow) filter->curIdx = 0;
+}
+
+float MedianFilterStep(MedianFilter_t * filter, const float sample) {
+    if (filter->mode == MEDIAN_HEAP) {
+        MedianHeapAddSample(filter, sample);
+        return filter->median;
+    }
 
     /* Remove last value. */
     float removeValue = filter->filter.buffer[filter->curIdx];
@@ -93,6 +223,20 @@ void MedianFilterAddSample(MedianFilter_t * filter, const float sample) {
     }
 
     filter->curIdx = (filter->curIdx + 1) % filter->maxSampleWindow;
+    return filter->median;
+}
+
+void MedianFilterAddSample(MedianFilter_t * filter, const float sample) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_MEDIAN);
+    assert(filter->filter.buffer != NULL);
+    assert(filter->filter.bufferSize > 0);
+    assert(filter->maxSampleWindow % 2 && filter->maxSampleWindow <= filter->filter.bufferSize);
+    assert(filter->curIdx < filter->filter.bufferSize);
+    assert(filter->mode != MEDIAN_HEAP || (filter->heapPos != NULL && filter->heap != NULL));
+
+    MedianFilterStep(filter, sample);
 }
 
 float MedianFilterGetSample(MedianFilter_t * filter) {
@@ -108,6 +252,12 @@ void MedianFilterClear(MedianFilter_t * filter) {
 
     filter->curIdx = 0;
     filter->median = 0;
+
+    if (filter->mode == MEDIAN_HEAP) {
+        MedianHeapReset(filter);
+        return;
+    }
+
     uint16_t i;
     for (i = 0; i < filter->maxSampleWindow; ++i) {
         filter->filter.buffer[i] = 0;
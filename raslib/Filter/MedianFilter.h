@@ -5,6 +5,14 @@
  * @version 0.1
  * @date 2021-11-03
  * @copyright Copyright (c) 2021
+ * @note
+ * Two median filter modes are provided:
+ * - Scan mode (MedianFilterInit). Uses only the sample buffer. Each insertion
+ *   that crosses the median rescans the window, so worst case cost is O(n).
+ * - Heap mode (MedianFilterHeapInit). Additionally requires a caller owned
+ *   index buffer and maintains a max-median-min heap over the window, so each
+ *   insertion is O(log n) and reads are O(1). Recommended for windows larger
+ *   than ~15 samples or for filters run inside of interrupts.
  */
 #pragma once
 
@@ -12,6 +20,13 @@
 #include <raslib/Filter/Filter.h>
 
 
+/** @brief MedianFilterMode is an enumeration specifying the median filter
+ *         engine used to track the median. */
+enum MedianFilterMode {
+    MEDIAN_SCAN,
+    MEDIAN_HEAP
+};
+
 typedef struct MedianFilter {
     Filter_t filter;
 
@@ -20,12 +35,60 @@ typedef struct MedianFilter {
     uint16_t maxSampleWindow;
 
     float median;
+
+    /** @brief The median engine used by this filter. */
+    enum MedianFilterMode mode;
+
+    /**
+     * @brief Heap mode only. For each sample slot in the buffer, the signed
+     *        position of the sample in the heap. Positive positions are in the
+     *        min heap (samples above the median), negative positions are in the
+     *        max heap (samples below the median) and 0 is the median.
+     */
+    int16_t * heapPos;
+
+    /**
+     * @brief Heap mode only. Points to the middle of the heap storage, such
+     *        that heap[0] is the buffer index of the median sample and
+     *        heap[-k], heap[k] are the max heap and min heap entries.
+     */
+    int16_t * heap;
 } MedianFilter_t;
 
+/**
+ * @brief MedianFilterInit initializes a scan mode median filter.
+ *
+ * @param config Filter configuration. The buffer should be zeroed.
+ * @return A MedianFilter_t instance.
+ */
 MedianFilter_t MedianFilterInit(const FilterConfig_t config);
 
+/**
+ * @brief MedianFilterHeapInit initializes a heap mode median filter. The
+ *        sample buffer is zeroed on initialization.
+ *
+ * @param config Filter configuration.
+ * @param indexBuffer A caller owned buffer of at least 2 * config.bufferSize
+ *                    entries used to store the heap. config.bufferSize must be
+ *                    less than or equal to INT16_MAX.
+ * @return A MedianFilter_t instance.
+ */
+MedianFilter_t MedianFilterHeapInit(const FilterConfig_t config, int16_t * indexBuffer);
+
 void MedianFilterAddSample(MedianFilter_t * filter, const float sample);
 
 float MedianFilterGetSample(MedianFilter_t * filter);
 
+/**
+ * @brief MedianFilterStep adds a sample and returns the new output, like
+ *        MedianFilterAddSample followed by MedianFilterGetSample, but without
+ *        checking its arguments. It is meant for callers that validated the
+ *        filter once, such as a FilterPipeline_t.
+ *
+ * @param filter Median filter.
+ * @param sample Sample to add.
+ * @return The new output.
+ */
+float MedianFilterStep(MedianFilter_t * filter, const float sample);
+
 void MedianFilterClear(MedianFilter_t * filter);
@@ -30,7 +30,11 @@ SMAFilter_t SMAFilterInit(const FilterConfig_t config) {
 
     SMAFilter_t smaFilter = {
         .filter=filter,
+        .mode=SMA_FLOAT,
         .sum=0,
+        .intBuffer=NULL,
+        .intSum=0,
+        .shift=0,
         .curIdx=0,
         .numSamples=0
     };
@@ -38,25 +42,80 @@ SMAFilter_t SMAFilterInit(const FilterConfig_t config) {
     return smaFilter;
 }
 
+SMAFilter_t SMAFilterIntInit(const FilterConfig_t config, uint16_t * history) {
+    /* Initialization asserts. 4096 * 4095 still fits in the uint32_t sum. */
+    assert(config.type == FILTER_SMA);
+    assert(history != NULL);
+    assert(config.bufferSize > 0 && config.bufferSize <= 4096);
+    assert((config.bufferSize & (config.bufferSize - 1)) == 0);
+
+    Filter_t filter = {
+        .type=FILTER_SMA,
+        .buffer=config.buffer,
+        .bufferSize=config.bufferSize
+    };
+
+    uint8_t shift = 0;
+    while ((1U << shift) < config.bufferSize) ++shift;
+
+    SMAFilter_t smaFilter = {
+        .filter=filter,
+        .mode=SMA_INT,
+        .sum=0,
+        .intBuffer=history,
+        .intSum=0,
+        .shift=shift,
+        .curIdx=0,
+        .numSamples=0
+    };
+
+    return smaFilter;
+}
+
+float SMAFilterStep(SMAFilter_t * filter, const float sample) {
+    /* Add sample. */
+    if (filter->numSamples < filter->filter.bufferSize) {
+        filter->numSamples++;
+        filter->sum += sample;
+    } else {
+        filter->sum += sample - filter->filter.buffer[filter->curIdx];
+    }
+
+    filter->filter.buffer[filter->curIdx] = sample;
+    filter->curIdx = (filter->curIdx + 1) % filter->filter.bufferSize;
+    return filter->sum / filter->numSamples;
+}
+
 void SMAFilterAddSample(SMAFilter_t * filter, const float sample) {
     /* Initialization asserts. */
     assert(filter != NULL);
     assert(filter->filter.type == FILTER_SMA);
+    assert(filter->mode == SMA_FLOAT);
     assert(filter->filter.buffer != NULL);
     assert(filter->filter.bufferSize > 0);
     assert(filter->numSamples <= filter->filter.bufferSize);
     assert(filter->curIdx < filter->filter.bufferSize);
 
+    SMAFilterStep(filter, sample);
+}
+
+void SMAFilterAddIntSample(SMAFilter_t * filter, const uint16_t sample) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_SMA);
+    assert(filter->mode == SMA_INT);
+    assert(filter->curIdx < filter->filter.bufferSize);
+
     /* Add sample. */
     if (filter->numSamples < filter->filter.bufferSize) {
         filter->numSamples++;
-        filter->sum += sample;
+        filter->intSum += sample;
     } else {
-        filter->sum += sample - filter->filter.buffer[filter->curIdx];
+        filter->intSum += sample - filter->intBuffer[filter->curIdx];
     }
 
-    filter->filter.buffer[filter->curIdx] = sample;
-    filter->curIdx = (filter->curIdx + 1) % filter->filter.bufferSize;
+    filter->intBuffer[filter->curIdx] = sample;
+    filter->curIdx = (filter->curIdx + 1) & (filter->filter.bufferSize - 1);
 }
 
 float SMAFilterGetSample(const SMAFilter_t * filter) {
@@ -67,15 +126,35 @@ float SMAFilterGetSample(const SMAFilter_t * filter) {
 
     if (filter->numSamples == 0) return 0.0;
 
+    if (filter->mode == SMA_INT) {
+        return (float)filter->intSum / filter->numSamples;
+    }
     return filter->sum / filter->numSamples;
 }
 
+uint16_t SMAFilterGetIntSample(const SMAFilter_t * filter) {
+    /* Initialization asserts. */
+    assert(filter != NULL);
+    assert(filter->filter.type == FILTER_SMA);
+    assert(filter->mode == SMA_INT);
+    assert(filter->numSamples <= filter->filter.bufferSize);
+
+    if (filter->numSamples == 0) return 0;
+
+    /* Full windows divide by a shift. Only the initial fill divides. */
+    if (filter->numSamples == filter->filter.bufferSize) {
+        return filter->intSum >> filter->shift;
+    }
+    return filter->intSum / filter->numSamples;
+}
+
 void SMAFilterClear(SMAFilter_t * filter) {
     /* Initialization asserts. */
     assert(filter != NULL);
     assert(filter->filter.type == FILTER_SMA);
 
     filter->sum = 0;
+    filter->intSum = 0;
     filter->curIdx = 0;
     filter->numSamples = 0;
-}
\ No newline at end of file
+}
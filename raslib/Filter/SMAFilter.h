@@ -5,6 +5,15 @@
  * @version 0.1
  * @date 2021-11-03
  * @copyright Copyright (c) 2021
+ * @note
+ * Two modes are provided:
+ * - Float mode (SMAFilterInit). Samples are stored in the FilterConfig_t
+ *   buffer and any window size is allowed.
+ * - Integer mode (SMAFilterIntInit). Raw ADC codes are stored in a caller
+ *   owned uint16_t history buffer and summed exactly in a uint32_t, so the
+ *   sum never drifts. The window is config.bufferSize and must be a power of
+ *   two, which makes the ring index a mask and a full window average a shift.
+ *   config.buffer may be NULL.
  */
 #pragma once
 
@@ -12,11 +21,30 @@
 #include <raslib/Filter/Filter.h>
 
 
+/** @brief SMAFilterMode is an enumeration specifying the arithmetic used by
+ *         the SMA filter. */
+enum SMAFilterMode {
+    SMA_FLOAT,
+    SMA_INT
+};
+
 typedef struct SMAFilter {
     Filter_t filter;
 
+    enum SMAFilterMode mode;
+
+    /** @brief Float mode only. Running sum of the window. */
     float sum;
 
+    /** @brief Integer mode only. bufferSize raw samples. */
+    uint16_t * intBuffer;
+
+    /** @brief Integer mode only. Exact running sum of the window. */
+    uint32_t intSum;
+
+    /** @brief Integer mode only. The window is 2^shift samples. */
+    uint8_t shift;
+
     uint16_t curIdx;
 
     uint16_t numSamples;
@@ -24,8 +52,55 @@ typedef struct SMAFilter {
 
 SMAFilter_t SMAFilterInit(const FilterConfig_t config);
 
+/**
+ * @brief SMAFilterIntInit initializes an integer mode SMA filter.
+ *
+ * @param config Filter configuration. bufferSize is the window and must be a
+ *               power of two, up to 4096 samples.
+ * @param history A caller owned buffer of at least config.bufferSize entries.
+ * @return An SMAFilter_t instance.
+ */
+SMAFilter_t SMAFilterIntInit(const FilterConfig_t config, uint16_t * history);
+
 void SMAFilterAddSample(SMAFilter_t * filter, const float sample);
 
+/**
+ * @brief SMAFilterAddIntSample adds a raw ADC code to an integer mode SMA
+ *        filter.
+ *
+ * @param filter Integer mode SMA filter.
+ * @param sample Sample to add, from [0, 4095].
+ */
+void SMAFilterAddIntSample(SMAFilter_t * filter, const uint16_t sample);
+
+/**
+ * @brief SMAFilterGetSample returns the average of the window. In integer
+ *        mode, this includes the fractional part.
+ *
+ * @param filter SMA filter.
+ * @return The current average.
+ */
 float SMAFilterGetSample(const SMAFilter_t * filter);
 
-void SMAFilterClear(SMAFilter_t * filter);
\ No newline at end of file
+/**
+ * @brief SMAFilterStep adds a sample and returns the new output, like
+ *        SMAFilterAddSample followed by SMAFilterGetSample, but without
+ *        checking its arguments. It is meant for callers that validated the
+ *        filter once, such as a FilterPipeline_t.
+ *
+ * @param filter Float mode SMA filter.
+ * @param sample Sample to add.
+ * @return The new output.
+ */
+float SMAFilterStep(SMAFilter_t * filter, const float sample);
+
+/**
+ * @brief SMAFilterGetIntSample returns the average of the window of an
+ *        integer mode SMA filter, truncated to an integer.
+ *
+ * @param filter Integer mode SMA filter.
+ * @return The current average.
+ */
+uint16_t SMAFilterGetIntSample(const SMAFilter_t * filter);
+
+void SMAFilterClear(SMAFilter_t * filter);
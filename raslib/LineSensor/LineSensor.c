@@ -36,9 +36,15 @@
  * - this driver allows you to initialize line sensors, read an unsigned
  *   16-bit value from the sensors, and set up periodic interrupts where data
  *   is read from a sensor at a desired frequency.
+ * - With isEventDriven, the thresholding is offloaded to one ADC digital
+ *   comparator per pin. The timer triggers the ADC in hardware and the CPU is
+ *   only interrupted when a pin crosses the threshold.
+ * - With isScheduled, the pins are sampled by the ADC scheduler, sharing
+ *   sequencers with other sensors instead of claiming one.
  */
 
 /** General imports. */
+#include <stdlib.h>
 #include <assert.h>
 
 /** Device specific imports. */
@@ -59,6 +65,14 @@ static struct LineSensorSettings {
     /** @brief The thresholding value inserted into LineSensorGetBoolArray. */
     uint16_t threshold;
 
+    /** @brief Arguments of the comparator of each pin. */
+    struct LineSensorPinEvent {
+        /** @brief User function called on a threshold crossing. */
+        void (*thresholdTask)(uint8_t pinIdx, bool isAboveThreshold);
+
+        uint8_t pinIdx;
+    } events[MAX_PINS_QTR_8];
+
 } sensorSettings[NUM_ADC_MODULES * NUM_ADC_SEQUENCERS];
 
 /**
@@ -79,19 +93,51 @@ void LineSensorReadInterrupt(uint32_t * args) {
     }
 }
 
+/**
+ * @brief LineSensorThresholdInterrupt is the generic handler passed to the
+ *        ADC digital comparators. It forwards the crossing to the user.
+ *
+ * @param isHigh Whether the pin is now at or above the threshold.
+ * @param args A pointer to a list of arguments. In this function, arg[0] should
+ *             be a pointer to an entry in the events of sensorSettings.
+ */
+void LineSensorThresholdInterrupt(bool isHigh, uint32_t * args) {
+    struct LineSensorPinEvent * event = ((struct LineSensorPinEvent *)args);
+    if (event->thresholdTask != NULL) {
+        event->thresholdTask(event->pinIdx, isHigh);
+    }
+}
+
 LineSensor_t LineSensorInit(LineSensorConfig_t config) {
     /* Initialization asserts. */
     assert(config.numPins <= MAX_PINS_QTR_8);
     assert(config.repeatFrequency <= 100);
     assert(config.threshold <= 4095);
+    assert(!config.isEventDriven || (config.isThresholded && 1 <= config.repeatFrequency));
+    assert(config.hysteresis <= config.threshold);
+    assert(!config.isScheduled || (!config.isEventDriven && 1 <= config.repeatFrequency));
 
     LineSensor_t sensor = {
         .values={0},
-        .numPins=config.numPins
+        .numPins=config.numPins,
+        .isScheduled=config.isScheduled
     };
 
     /* For each pin. */
     uint8_t i;
+
+    /* Request the pins from the ADC scheduler, which picks the sequencers. */
+    if (config.isScheduled) {
+        for (i = 0; i < config.numPins; ++i) {
+            ADCChannelConfig_t channelConfig = {
+                .pin=config.pins[i],
+                .frequency=config.repeatFrequency
+            };
+            sensor.channels[i] = ADCSchedulerAddChannel(channelConfig);
+        }
+        return sensor;
+    }
+
     for (i = 0; i < config.numPins; ++i) {
         /* Set up the appropriate ADC. */
         ADCConfig_t adcConfig = {
@@ -100,11 +146,41 @@ LineSensor_t LineSensorInit(LineSensorConfig_t config) {
             .sequencer=config.sequencer,
             .position=(enum ADCSequencePosition)i,
             .isNotEndSample=i<(config.numPins-1),
+            .priority=5,
+            .trigger=config.isEventDriven ? ADC_TRIGGER_TIMER : ADC_TRIGGER_PROCESSOR
         };
         ADC_t adc = ADCInit(adcConfig);
         sensor.adcs[i] = adc;
     }
-    
+
+    /* Offload the threshold of each pin to a digital comparator, sampled by
+       the timer in hardware. */
+    if (config.isEventDriven) {
+        uint8_t idx = config.module * 4 + config.sequencer;
+        for (i = 0; i < config.numPins; ++i) {
+            sensorSettings[idx].events[i].thresholdTask = config.thresholdTask;
+            sensorSettings[idx].events[i].pinIdx = i;
+
+            ADCComparatorConfig_t comparatorConfig = {
+                .adc=sensor.adcs[i],
+                .lowThreshold=config.threshold - config.hysteresis,
+                .highThreshold=config.threshold,
+                .comparatorTask=LineSensorThresholdInterrupt,
+                .comparatorArgs=(uint32_t *)&sensorSettings[idx].events[i]
+            };
+            sensor.comparators[i] = ADCComparatorInit(comparatorConfig);
+        }
+
+        TimerConfig_t timerConfig = {
+            .timerID=config.timer,
+            .period=freqToPeriod(config.repeatFrequency, MAX_FREQ),
+            .isPeriodic=true,
+            .isADCTrigger=true
+        };
+        TimerInit(timerConfig);
+        return sensor;
+    }
+
     /* Set up a recurring timer on TIMER_3 with priority 5. */
     if (1 <= config.repeatFrequency && config.repeatFrequency <= 100) {
         uint8_t idx = config.module * 4 + config.sequencer;
@@ -128,11 +204,18 @@ LineSensor_t LineSensorInit(LineSensorConfig_t config) {
 }
 
 void LineSensorGetIntArray(LineSensor_t * sensor) {
+    if (sensor->isScheduled) {
+        uint8_t i;
+        for (i = 0; i < sensor->numPins; ++i) {
+            sensor->values[i] = ADCSchedulerRead(sensor->channels[i]);
+        }
+        return;
+    }
     ADCSampleSequencer(sensor->adcs[0].module, sensor->adcs[0].sequencer, sensor->values);
 }
 
 void LineSensorGetBoolArray(LineSensor_t * sensor, uint16_t threshold) {
-    ADCSampleSequencer(sensor->adcs[0].module, sensor->adcs[0].sequencer, sensor->values);
+    LineSensorGetIntArray(sensor);
     uint8_t i;
     for (i = 0; i < sensor->numPins; ++i) {
         if (sensor->values[i] >= threshold) {
@@ -142,3 +225,10 @@ void LineSensorGetBoolArray(LineSensor_t * sensor, uint16_t threshold) {
         }
     }
 }
+
+void LineSensorGetEventBoolArray(LineSensor_t * sensor) {
+    uint8_t i;
+    for (i = 0; i < sensor->numPins; ++i) {
+        sensor->values[i] = ADCComparatorIsHigh(sensor->comparators[i]);
+    }
+}
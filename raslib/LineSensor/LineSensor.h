@@ -36,6 +36,11 @@
  * - this driver allows you to initialize line sensors, read an unsigned
  *   16-bit value from the sensors, and set up periodic interrupts where data
  *   is read from a sensor at a desired frequency.
+ * - With isEventDriven, the thresholding is offloaded to one ADC digital
+ *   comparator per pin. The timer triggers the ADC in hardware and the CPU is
+ *   only interrupted when a pin crosses the threshold.
+ * - With isScheduled, the pins are sampled by the ADC scheduler, sharing
+ *   sequencers with other sensors instead of claiming one.
  */
 #pragma once
 
@@ -45,6 +50,7 @@
 
 /** Device specific imports. */
 #include <lib/ADC/ADC.h>
+#include <lib/ADC/ADCScheduler.h>
 #include <lib/Timer/Timer.h>
 
 
@@ -113,6 +119,54 @@ typedef struct LineSensorConfig {
      */
     uint16_t threshold;
 
+    /**
+     * @brief Whether the thresholding is done in hardware by ADC digital
+     * comparators, one per pin, instead of by LineSensorGetBoolArray. The
+     * timer triggers the ADC directly at repeatFrequency, and thresholdTask is
+     * only called when a pin crosses the threshold. Requires isThresholded
+     * and a repeatFrequency. Read the state with LineSensorGetEventBoolArray.
+     * LineSensorGetIntArray and LineSensorGetBoolArray are unavailable, since
+     * samples no longer reach the ADC FIFO.
+     *
+     * @note A module has 8 comparators, shared by all event driven sensors on
+     *       the module.
+     *
+     * Default false.
+     */
+    bool isEventDriven;
+
+    /**
+     * @brief If isEventDriven is enabled, a pin reads 1 once a sample is at or
+     * above threshold, and reads 0 again once a sample is below threshold -
+     * hysteresis. Fixed to [0, threshold].
+     *
+     * Default is 0.
+     */
+    uint16_t hysteresis;
+
+    /**
+     * @brief If isEventDriven is enabled, the function called from the ADC
+     * interrupt whenever a pin crosses the threshold, with the index of the
+     * pin in pins and whether it is now at or above the threshold.
+     *
+     * Default is NULL (No function defined).
+     */
+    void (*thresholdTask)(uint8_t pinIdx, bool isAboveThreshold);
+
+    /**
+     * @brief Whether the pins are sampled by the ADC scheduler at
+     * repeatFrequency, sharing sequencers with every other scheduled consumer,
+     * instead of on module and sequencer. module, sequencer and timer are then
+     * ignored, and LineSensorGetIntArray and
+     * LineSensorGetBoolArray read the latest samples without
+     * converting. Requires a repeatFrequency. ADCSchedulerStart must be called
+     * once every scheduled consumer is initialized. Cannot be combined with
+     * isEventDriven.
+     *
+     * Default false.
+     */
+    bool isScheduled;
+
     /**
      * @brief The ADC module associated with the ADC Pin. There are two ADC
      * modules in the TM4C123GH6PM and both can operate simultaneously.
@@ -163,6 +217,15 @@ typedef struct LineSensor {
      * duplicates.
      */
     uint8_t numPins;
+
+    /** @brief The ADC digital comparators used if isEventDriven. */
+    ADCComparator_t comparators[MAX_PINS_QTR_8];
+
+    /** @brief The ADC scheduler channels used if isScheduled. */
+    ADCChannel_t channels[MAX_PINS_QTR_8];
+
+    /** @brief Whether the pins are sampled by the ADC scheduler. */
+    bool isScheduled;
 } LineSensor_t;
 
 /**
@@ -202,3 +265,12 @@ void LineSensorGetIntArray(LineSensor_t * sensor);
  *       is stores in pins[5]).
  */
 void LineSensorGetBoolArray(LineSensor_t * sensor, uint16_t threshold);
+
+/**
+ * @brief LineSensorGetEventBoolArray reads the thresholded state of each pin
+ * of an isEventDriven line sensor into the values member of the LineSensor
+ * object, without sampling. The values are in the range [0, 1].
+ *
+ * @param sensor A pointer to the LineSensor_t struct.
+ */
+void LineSensorGetEventBoolArray(LineSensor_t * sensor);
@@ -84,7 +84,8 @@ void RGBInit(void) {
         RGBStep,
         true,
         7,
-        NULL
+        NULL,
+        false
     };
     timer = TimerInit(tConf);
 }